@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MaterialAuxBase.h"
+#include "LayeredBeamState.h"
+
+#include <map>
+
+class LayeredBeamStateAux;
+
+template <>
+InputParameters validParams<LayeredBeamStateAux>();
+
+/**
+ * Outputs one layer value (stress, plastic strain or hardening variable) of the packed
+ * LayeredBeamState material property. The stress of a compact state is the stored stress
+ * gradient times the fiber distance, which is taken from the LayeredBeam declaring the property.
+ */
+class LayeredBeamStateAux : public MaterialAuxBase<LayeredBeamState>
+{
+public:
+  static InputParameters validParams();
+
+  LayeredBeamStateAux(const InputParameters & parameters);
+
+protected:
+  virtual Real getRealValue() override;
+
+  /// Fiber distances of the section of the current element
+  const std::vector<Real> & layerZ();
+
+  /// Quantity to output
+  const LayeredBeamState::Quantity _quantity;
+
+  /// Layer to output
+  const unsigned int _layer;
+
+  /// Problem holding the LayeredBeam materials
+  FEProblemBase & _problem;
+
+  /// Fiber distances of each block, looked up on first use
+  std::map<SubdomainID, const std::vector<Real> *> _layer_z;
+};
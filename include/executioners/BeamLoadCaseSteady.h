@@ -0,0 +1,52 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "Steady.h"
+
+// Forward Declarations
+class BeamLoadCaseSteady;
+
+template <>
+InputParameters validParams<BeamLoadCaseSteady>();
+
+/**
+ * Solves a number of load cases of a linear elastic beam model in one run. Load case k is solved
+ * at time k, so loads given as functions of time select their value for each case, and the
+ * postprocessors and outputs are evaluated once per case. The state is not advanced between the
+ * cases, so every case starts from the initial state and the cases are independent of each
+ * other. The Jacobian is assembled and factored for the first case only and reused by the
+ * others. Each of them then costs one Newton step: the initial residual, one back substitution
+ * and the residual that confirms convergence.
+ */
+class BeamLoadCaseSteady : public Steady
+{
+public:
+  static InputParameters validParams();
+
+  BeamLoadCaseSteady(const InputParameters & parameters);
+
+  virtual void execute() override;
+
+protected:
+  /// Keeps PETSc from rebuilding the Jacobian and the preconditioner in the following solves
+  void freezeJacobian();
+
+  /// Number of load cases
+  const unsigned int _num_load_cases;
+
+  /// Whether the Jacobian of the first load case is reused by the others
+  const bool _reuse_jacobian;
+
+  /// Timers of the first, factoring solve and of the solves reusing its factorization
+  const PerfID _first_case_timer;
+  const PerfID _load_case_timer;
+};
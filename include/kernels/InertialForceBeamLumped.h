@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TimeKernel.h"
+#include "RankTwoTensorForward.h"
+
+/**
+ * Lumped translational and rotary inertia of a two-node beam element. Half of the element mass
+ * and rotary inertia is placed on each node, so the mass matrix is diagonal and can be used with
+ * the lumped CentralDifference time integrator for explicit beam dynamics.
+ *
+ * An explicit step evaluates the beam materials at the solution of the previous step only, so the
+ * incremental beam materials have to be evaluated once more at the end of each step to store the
+ * resultants of the new solution. A BeamCriticalTimeStep postprocessor executed on timestep_end,
+ * which also sets the time step, does this.
+ */
+class InertialForceBeamLumped : public TimeKernel
+{
+public:
+  static InputParameters validParams();
+
+  InertialForceBeamLumped(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int /*jvar*/) override {}
+
+protected:
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Nodal mass or rotary inertia of this component for the current element
+  Real computeNodalInertia() const;
+
+  /// Direction 0-2 for translations and 3-5 for rotations
+  const unsigned int _component;
+
+  /// Density of the beam
+  const MaterialProperty<Real> & _density;
+
+  /// Section area and second moments of area about the local axes
+  const VariableValue & _area;
+  const VariableValue & _Iy;
+  const VariableValue & _Iz;
+  const VariableValue & _Ix;
+  const bool _has_Ix;
+
+  /// Initial length of the beam
+  const MaterialProperty<Real> & _original_length;
+
+  /// Rotational transformation from global to current beam local coordinate system
+  const MaterialProperty<RankTwoTensor> & _total_rotation;
+
+  /// Nodal second time derivatives and their derivative with respect to the nodal values
+  const VariableValue & _u_dotdot_nodal;
+  const VariableValue & _du_dotdot_du;
+};
@@ -0,0 +1,53 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "StressDivergenceBeaml.h"
+
+/**
+ * Beam stress divergence kernel acting on all displacement and rotation variables at once. The
+ * element forces and moments are rotated and integrated a single time and scattered into the
+ * residual and Jacobian blocks of every coupled variable, replacing one StressDivergenceBeaml
+ * per component.
+ */
+class StressDivergenceBeamFused : public StressDivergenceBeaml
+{
+public:
+  static InputParameters validParams();
+
+  StressDivergenceBeamFused(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  virtual void initialSetup() override;
+
+protected:
+  /// Adds the element stiffness as one 12x12 block, used when all variables are coupled
+  void computeFullJacobian(Real scaling);
+
+  /// Adds the element stiffness one variable pair at a time, skipping uncoupled pairs
+  void computeBlockJacobian(Real scaling);
+
+  /// Variable number of each component, displacements first and rotations second
+  std::vector<unsigned int> _component_var;
+
+  /// Variable of each component, displacements first and rotations second
+  std::vector<MooseVariable *> _component_variables;
+
+  /// Whether every pair of the beam variables is present in the sparsity pattern
+  bool _fully_coupled;
+
+  /// Element stiffness over all components, ordered by component and then by node
+  DenseMatrix<Number> _full_ke;
+
+  /// Global DOF indices matching the rows and columns of _full_ke
+  std::vector<dof_id_type> _full_dof_indices;
+};
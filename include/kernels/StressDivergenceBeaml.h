@@ -11,8 +11,14 @@
 
 #include "Kernel.h"
 #include "RankTwoTensorForward.h"
+#include "BeamTrace.h"
+#include "BeamTimedSection.h"
 
-class StressDivergenceBeaml : public Kernel
+#include "libmesh/dense_matrix.h"
+
+#include <unordered_map>
+
+class StressDivergenceBeaml : public Kernel, public BeamTraceInterface, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
@@ -21,10 +27,28 @@ public:
   virtual void computeResidual() override;
   virtual void computeJacobian() override;
   virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  virtual void timestepSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void meshChanged() override;
 
 protected:
   virtual Real computeQpResidual() override { return 0.0; }
 
+  /**
+   * Stiffness entry relating DOF j of coupled_component to the residual at DOF i of component.
+   * Components 0-2 are the displacements and 3-5 the rotations.
+   */
+  Real computeStiffnessEntry(unsigned int component,
+                             unsigned int coupled_component,
+                             unsigned int i,
+                             unsigned int j) const;
+
+  /**
+   * Builds the global element stiffness of the current element from the consistent tangent of
+   * the resultant plasticity material, once per element and Jacobian evaluation
+   */
+  void computeElastoplasticStiffness();
+
   /// Computes the force and moment due to stiffness proportional damping and HHT time integration
   void computeDynamicTerms(std::vector<RealVectorValue> & global_force_res,
                            std::vector<RealVectorValue> & global_moment_res);
@@ -105,6 +129,37 @@ protected:
   /// Rotational transformation from global to older beam local coordinate system
   const MaterialProperty<RankTwoTensor> * _total_rotation_older;
 
+  /// Whether the Jacobian is assembled, false for explicit time integration
+  const bool _compute_jacobian;
+
+  /**
+   * Whether only the 6x6 diagonal block of each node is assembled, to precondition PJFNK solves.
+   * The matrix is still allocated with the element sparsity pattern.
+   */
+  const bool _nodal_block_jacobian;
+
+  /// Whether the stiffness is built from a consistent elastoplastic tangent
+  const bool _use_elastoplastic_tangent;
+
+  /**
+   * Consistent tangent of the forces (1) and moments (2) with respect to the displacement (1)
+   * and rotational (2) strain increments in the beam local frame, only used with the tangent
+   */
+  const MaterialProperty<RankTwoTensor> * _tangent_11;
+  const MaterialProperty<RankTwoTensor> * _tangent_12;
+  const MaterialProperty<RankTwoTensor> * _tangent_21;
+  const MaterialProperty<RankTwoTensor> * _tangent_22;
+
+  /// Section area and the torsional and bending inertias scaling the strain increments
+  const MaterialProperty<Real> * _section_area;
+  const MaterialProperty<RealVectorValue> * _section_inertia;
+
+  /// Global stiffness of the current element from the tangent, ordered as (u0, r0, u1, r1)
+  DenseMatrix<Real> _elastoplastic_stiffness;
+
+  /// Element _elastoplastic_stiffness was built for in the current Jacobian evaluation
+  const Elem * _elastoplastic_elem;
+
   /// Residual corresponding to displacement DOFs at the nodes in global coordinate system
   std::vector<RealVectorValue> _global_force_res;
 
@@ -122,4 +177,21 @@ protected:
 
   /// Residual corresponding to rotational DOFs at the nodes in beam local coordinate system
   std::vector<RealVectorValue> _local_moment_res;
+
+  /// Global nodal residuals from the old and older forces and moments of one element
+  struct DynamicResidualHistory
+  {
+    std::vector<RealVectorValue> force_old;
+    std::vector<RealVectorValue> moment_old;
+    std::vector<RealVectorValue> force_older;
+    std::vector<RealVectorValue> moment_older;
+  };
+
+  /// Old and older residual contributions of the elements visited in the current time step
+  std::unordered_map<dof_id_type, DynamicResidualHistory> _dynamic_history;
+
+  /// Timed sections of the residual and Jacobian assembly
+  const PerfID _compute_residual_timer;
+  const PerfID _compute_jacobian_timer;
+  const PerfID _compute_off_diag_jacobian_timer;
 };
@@ -11,6 +11,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "BeamTrace.h"
 
 /**
  * ComputeBeamResultantsl computes forces and moments using elasticity
@@ -21,7 +22,7 @@ class ComputeBeamResultantsl;
 template <>
 InputParameters validParams<ComputeBeamResultantsl>();
 
-class ComputeBeamResultantsl : public Material
+class ComputeBeamResultantsl : public Material, public BeamTraceInterface
 {
 public:
   static InputParameters validParams();
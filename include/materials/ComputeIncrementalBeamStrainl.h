@@ -11,6 +11,9 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "BeamTrace.h"
+#include "BeamTimedSection.h"
+#include "BeamGeometryCache.h"
 
 // Forward Declarations
 class Function;
@@ -19,7 +22,9 @@ class Function;
  * ComputeIncrementalBeamStrainl defines a displacement and rotation strain increment and rotation
  * increment (=1), for small strains.
  */
-class ComputeIncrementalBeamStrainl : public Material
+class ComputeIncrementalBeamStrainl : public Material,
+                                      public BeamTraceInterface,
+                                      public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
@@ -28,6 +33,8 @@ public:
 
   virtual void computeProperties() override;
 
+  virtual void meshChanged() override;
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -74,6 +81,7 @@ protected:
   const VariableValue & _Ix;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
+  /// of the current element, refreshed from the geometry cache in computeProperties()
   RankTwoTensor _original_local_config;
 
   /// Initial length of the beam
@@ -145,22 +153,21 @@ protected:
   /// Vector of old rotational eigenstrains
   std::vector<const MaterialProperty<RealVectorValue> *> _rot_eigenstrain_old;
 
-  /// Displacement and rotations at the two nodes of the beam in the global coordinate system
+  /// Displacement and rotations at the two nodes of the beam in the global coordinate system.
+  /// Like the other per element scratch members these are only valid within computeProperties();
+  /// each thread owns its own material object, so they are never shared between threads.
   RealVectorValue _disp0, _disp1, _rot0, _rot1;
 
-  /// Reference to the nonlinear system object
-  NonlinearSystemBase & _nonlinear_sys;
-  /// Indices of solution vector corresponding to displacement DOFs at the node 0
-  std::vector<unsigned int> _soln_disp_index_0;
-
-  /// Indices of solution vector corresponding to displacement DOFs at the node 1
-  std::vector<unsigned int> _soln_disp_index_1;
+  /// Nodal values of the displacement variables at time t and t - dt
+  std::vector<const VariableValue *> _disp_dofs;
+  std::vector<const VariableValue *> _disp_dofs_old;
 
-  /// Indices of solution vector corresponding to rotation DOFs at the node 0
-  std::vector<unsigned int> _soln_rot_index_0;
+  /// Nodal values of the rotation variables at time t and t - dt
+  std::vector<const VariableValue *> _rot_dofs;
+  std::vector<const VariableValue *> _rot_dofs_old;
 
-  /// Indices of solution vector corresponding to rotation DOFs at the node 1
-  std::vector<unsigned int> _soln_rot_index_1;
+  /// Cache of the element length, initial orientation and section averages
+  std::unique_ptr<BeamGeometryCache> _geometry_cache;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
   MaterialProperty<RankTwoTensor> & _initial_rotation;
@@ -168,6 +175,15 @@ protected:
   /// Psuedo stiffness for critical time step computation
   MaterialProperty<Real> & _effective_stiffness;
 
+  /// Element averages of the area and of the moments of inertia (Ix, Iz, Iy), which scale the
+  /// rotational strain increments
+  MaterialProperty<Real> & _section_area;
+  MaterialProperty<RealVectorValue> & _section_inertia;
+
   /// Prefactor function to multiply the elasticity tensor with
   const Function * const _prefactor_function;
+
+  /// Timed sections of the hot path
+  const PerfID _compute_properties_timer;
+  const PerfID _compute_stiffness_matrix_timer;
 };
@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "LayeredBeam.h"
+
+// Forward Declarations
+class HybridLayeredBeam;
+
+template <>
+InputParameters validParams<HybridLayeredBeam>();
+
+/**
+ * LayeredBeam that integrates elastic elements with the closed form resultant law M = EI * kappa
+ * and switches an element to layer by layer integration once the moment at one of its qps
+ * exceeds a fraction of the first yield moment of the section. The layer state of all qps of the
+ * element is allocated at the switch, and the element stays layered from then on. Frames whose
+ * plasticity is localized then only store and integrate the layers of the elements near the
+ * plastic zones.
+ */
+class HybridLayeredBeam : public LayeredBeam
+{
+public:
+  static InputParameters validParams();
+
+  HybridLayeredBeam(const InputParameters & parameters);
+
+  virtual void computeProperties() override;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+
+  /// Moment at which an element is switched to layered integration
+  const Real _switch_moment;
+
+  /// 1 at the qps of elements integrated layer by layer, 0 at those using the resultant law
+  MaterialProperty<Real> & _layered_integration;
+};
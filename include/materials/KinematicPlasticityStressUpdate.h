@@ -10,6 +10,8 @@
 #pragma once
 
 #include "RadialReturnStressUpdate.h"
+#include "HardeningCurve.h"
+#include "BeamTimedSection.h"
 
 /**
  * This class uses the Discrete material in a radial return Kinematic plasticity
@@ -29,14 +31,21 @@
  * Press, pg. 146 - 149.
  */
 
-class KinematicPlasticityStressUpdate : public RadialReturnStressUpdate
+class KinematicPlasticityStressUpdate : public RadialReturnStressUpdate, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
 
   KinematicPlasticityStressUpdate(const InputParameters & parameters);
 
+  /// The consistent tangent of the kinematic return is returned in full, not as a partial one
+  virtual TangentCalculationMethod getTangentCalculationMethod() override
+  {
+    return TangentCalculationMethod::FULL;
+  }
+
 protected:
+  virtual void initialSetup() override;
   virtual void initQpStatefulProperties() override;
   virtual void propagateQpStatefulProperties() override;
 
@@ -55,12 +64,20 @@ protected:
   virtual Real computeResidual(const Real & effective_trial_stress, const Real & scalar) override;
   virtual Real computeReferenceResidual(const Real & effective_trial_stress, const Real & scalar_effective_inelastic_strain) override;
   virtual Real computeDerivative(const Real & effective_trial_stress, const Real & scalar) override;
-  virtual void iterationFinalize(Real scalar) override;
   virtual void computeStressFinalize(const RankTwoTensor & plastic_strain_increment) override;
 
   virtual void computeYieldStress(const RankFourTensor & elasticity_tensor);
   virtual Real computeHardeningDerivative(Real scalar);
 
+  /**
+   * Consistent elastoplastic tangent of the stress update, including the back stress
+   * @param effective_stress deviatoric trial stress less the old back stress
+   */
+  void computeKinematicTangentOperator(const RankTwoTensor & effective_stress,
+                                       Real effective_trial_stress,
+                                       const RankFourTensor & elasticity_tensor,
+                                       RankFourTensor & tangent_operator);
+
   /// a string to prepend to the plastic strain Material Property name
   const std::string _plastic_prepend;
 
@@ -69,9 +86,15 @@ protected:
   const Real _hardening_constant;
   const Function * const _hardening_function;
 
+  /// Tabulated hardening_function
+  HardeningCurve _hardening_curve;
+
   Real _yield_condition;
   Real _hardening_slope;
 
+  /// Accumulated plastic strain at the start of the increment, for the hardening curve
+  Real _effective_inelastic_strain_start;
+
   /// plastic strain in this model
   MaterialProperty<RankTwoTensor> & _plastic_strain;
 
@@ -83,4 +106,16 @@ protected:
   MaterialProperty<RankTwoTensor> & _back_stress;
   const MaterialProperty<RankTwoTensor> & _back_stress_old;
   const VariableValue & _temperature;
+
+  /// 1 where the qp yielded in the last increment
+  MaterialProperty<Real> & _yielded_layers;
+
+  /// Newton iterations of the radial return at each qp in the last increment
+  MaterialProperty<Real> & _return_mapping_iterations;
+
+  /// Timed section of the stress update
+  const PerfID _update_state_timer;
+
+  /// Deviatoric projection of symmetric second order tensors
+  const RankFourTensor _deviatoric_projection;
 };
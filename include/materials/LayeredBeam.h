@@ -11,6 +11,11 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "BeamTrace.h"
+#include "BeamTimedSection.h"
+#include "BeamGeometryCache.h"
+#include "LayeredBeamState.h"
+#include "LayeredSectionReturnMapping.h"
 
 /**
  * LayeredBeam defines a displacement and rotation strain increment and rotation
@@ -24,15 +29,30 @@ class Function;
 template <>
 InputParameters validParams<LayeredBeam>();
 
-class LayeredBeam : public Material
+class LayeredBeam : public Material, public BeamTraceInterface, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
 
   LayeredBeam(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual void computeProperties() override;
 
+  virtual void meshChanged() override;
+
+  /// Distance of each integration fiber from the section centroid, in layer order
+  const std::vector<Real> & layerZ() const { return _return_mapping.layerZ(); }
+
+  /**
+   * Finds the LayeredBeam that declares a layer state property on a block, so that output objects
+   * can recover the layer stresses of compact states from the fiber distances
+   * @return the material, or nullptr if no LayeredBeam on the block declares the property
+   */
+  static const LayeredBeam *
+  find(FEProblemBase & problem, const std::string & property, SubdomainID block, THREAD_ID tid);
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -45,11 +65,11 @@ protected:
   /// Computes the rotation matrix at time t. For small rotation scenarios, the rotation matrix at time t is same as the intiial rotation matrix
   virtual void computeRotation();
 
-  //
+  /// Computes the layer stresses and the resulting moment at the current qp
   void computeQpStress();
-  virtual Real computeHardeningValue(Real scalar, Real j);
-  virtual Real computeHardeningDerivative(Real scalar, Real j);
 
+  /// Places the integration fibers of the section and passes them to the return mapping
+  void computeSectionFibers();
 
   /// Booleans for validity of params
   const bool _has_Ix;
@@ -60,7 +80,7 @@ protected:
   /// Number of coupled displacement variables
   unsigned int _ndisp;
 
-  /// number of x-sec layers to consider
+  /// Total number of integration fibers (layers) through the section
   unsigned int _nlayers;
 
   /// Variable numbers corresponding to the rotational variables
@@ -72,11 +92,14 @@ protected:
   /// Coupled variable for the beam cross-sectional area
   const VariableValue & _area;
 
-  /// Coupled variable for the beam width
-  const Real & _width;
+  /// Width of each section segment, from bottom to top
+  const std::vector<Real> _width;
 
-  /// Coupled variable for the beam depth
-  const Real & _depth;
+  /// Thickness of each section segment, empty for a single segment spanning the depth
+  const std::vector<Real> _thickness;
+
+  /// Total depth of the section
+  Real _depth;
 
   /// Coupled variable for the first moment of area in y direction, i.e., integral of y*dA over the cross-section
   const VariableValue & _Ay;
@@ -94,6 +117,7 @@ protected:
   const VariableValue & _Ix;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
+  /// of the current element, refreshed from the geometry cache in computeProperties()
   RankTwoTensor _original_local_config;
 
   /// Initial length of the beam
@@ -165,22 +189,21 @@ protected:
   /// Vector of old rotational eigenstrains
   std::vector<const MaterialProperty<RealVectorValue> *> _rot_eigenstrain_old;
 
-  /// Displacement and rotations at the two nodes of the beam in the global coordinate system
+  /// Displacement and rotations at the two nodes of the beam in the global coordinate system.
+  /// Like the other per element scratch members these are only valid within computeProperties();
+  /// each thread owns its own material object, so they are never shared between threads.
   RealVectorValue _disp0, _disp1, _rot0, _rot1;
 
-  /// Reference to the nonlinear system object
-  NonlinearSystemBase & _nonlinear_sys;
-  /// Indices of solution vector corresponding to displacement DOFs at the node 0
-  std::vector<unsigned int> _soln_disp_index_0;
-
-  /// Indices of solution vector corresponding to displacement DOFs at the node 1
-  std::vector<unsigned int> _soln_disp_index_1;
+  /// Nodal values of the displacement variables at time t and t - dt
+  std::vector<const VariableValue *> _disp_dofs;
+  std::vector<const VariableValue *> _disp_dofs_old;
 
-  /// Indices of solution vector corresponding to rotation DOFs at the node 0
-  std::vector<unsigned int> _soln_rot_index_0;
+  /// Nodal values of the rotation variables at time t and t - dt
+  std::vector<const VariableValue *> _rot_dofs;
+  std::vector<const VariableValue *> _rot_dofs_old;
 
-  /// Indices of solution vector corresponding to rotation DOFs at the node 1
-  std::vector<unsigned int> _soln_rot_index_1;
+  /// Cache of the element length, initial orientation and section averages
+  std::unique_ptr<BeamGeometryCache> _geometry_cache;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
   MaterialProperty<RankTwoTensor> & _initial_rotation;
@@ -202,19 +225,45 @@ protected:
   MaterialProperty<Real> & _total_stretch;
   const MaterialProperty<Real> & _total_stretch_old;
 
-  /// basically, instead of material property that is a vector
-  /// we're creating a vector of material properties
-  std::vector<MaterialProperty<Real> *> _direct_stress;
-  std::vector<const MaterialProperty<Real> *> _direct_stress_old;
-  std::vector<MaterialProperty<Real> *> _plastic_strain;
-  std::vector<const MaterialProperty<Real> *> _plastic_strain_old;
+  /// Packed stress, plastic strain and hardening variable of all layers
+  MaterialProperty<LayeredBeamState> & _layer_state;
+  const MaterialProperty<LayeredBeamState> & _layer_state_old;
+
+  /// Whether sections that have never yielded are stored in compact form
+  const bool _compact_elastic_state;
+
   MaterialProperty<Real> & _stres;
   const MaterialProperty<Real> & _stres_old;
   const MaterialProperty<RealVectorValue> & _moment_old;
   const MaterialProperty<RealVectorValue> & _material_flexure;
-  std::vector<MaterialProperty<Real> *> _hardening_variable;
-  std::vector<const MaterialProperty<Real> *> _hardening_variable_old;
+
+  /**
+   * Algorithmic flexural tangent of the section, the derivative of the moment with respect to the
+   * curvature increment of the step. It is not stateful: it is recomputed with the return mapping
+   * before the stiffness matrix is built, and enters StressDivergenceBeaml through Jacobian_22.
+   */
+  MaterialProperty<Real> & _flexural_tangent;
 
   /// maximum no. of iterations
   const unsigned int _max_its;
+
+  /// Maximum number of substeps of the curvature increment
+  const unsigned int _max_substeps;
+
+  /// Number of substeps used at each qp in the last increment
+  MaterialProperty<Real> & _substeps;
+
+  /// Number of yielded layers at each qp in the last increment
+  MaterialProperty<Real> & _yielded_layers;
+
+  /// Local Newton iterations summed over the layers at each qp in the last increment
+  MaterialProperty<Real> & _return_mapping_iterations;
+
+  /// Substepped layer return mapping of the section, closed form for linear hardening
+  LayeredSectionReturnMapping _return_mapping;
+
+  /// Timed sections of the hot path
+  const PerfID _compute_properties_timer;
+  const PerfID _compute_qp_stress_timer;
+  const PerfID _compute_stiffness_matrix_timer;
 };
@@ -11,22 +11,37 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "BeamResultantReturnMapping.h"
+#include "BeamResultantState.h"
+#include "BeamTimedSection.h"
 
 /**
- * NonlinearBeam computes forces and moments using elasticity
+ * NonlinearBeam computes forces and moments using elasticity and a resultant yield surface in
+ * the axial force and the three moments, returned to with a closest point projection. The return
+ * is done on the generalized stresses in the beam local coordinate system; the consistent
+ * tangent of the return is stored in that system as four 3x3 blocks, elastic when the section
+ * does not yield.
  */
 
-class NonlinearBeam : public Material
+class NonlinearBeam : public Material, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
 
   NonlinearBeam(const InputParameters & parameters);
 
+  virtual void computeProperties() override;
+
 protected:
   virtual void computeQpProperties() override;
   virtual void initQpStatefulProperties() override;
 
+  /// Copies the plastic history of the current qp into the output properties
+  void fillPlasticOutput();
+
+  /// Sets the global force and moment from the local generalized stresses
+  void setLocalResultants(const BeamResultantReturnMapping::Vector & stress);
+
   /// Mechanical displacement strain increment in beam local coordinate system
   const MaterialProperty<RealVectorValue> & _disp_strain_increment;
 
@@ -59,6 +74,7 @@ protected:
   RealVectorValue _yield_moments;
   Real _kinematic_hardening_coefficient;
   Real _isotropic_hardening_coefficient;
+
   const Real _kinematic_hardening_slope;
   const Real _isotropic_hardening_slope;
   const Real _hardening_constant;
@@ -67,24 +83,46 @@ protected:
   Real _absolute_tolerance;
   Real _relative_tolerance;
 
-  /// Hardening variables at current and previous time step
+  /// Plastic history, only stored once the section has yielded
+  MaterialProperty<BeamResultantState> & _plastic_state;
+  const MaterialProperty<BeamResultantState> & _plastic_state_old;
+
+  /// Hardening variables at the current time step, filled from the plastic history for output
   MaterialProperty<RealVectorValue> & _iso_hardening_variable_force;
-  const MaterialProperty<RealVectorValue> & _iso_hardening_variable_force_old;
   MaterialProperty<RealVectorValue> & _iso_hardening_variable_moment;
-  const MaterialProperty<RealVectorValue> & _iso_hardening_variable_moment_old;
   MaterialProperty<RealVectorValue> & _kin_hardening_variable_force;
-  const MaterialProperty<RealVectorValue> & _kin_hardening_variable_force_old;
   MaterialProperty<RealVectorValue> & _kin_hardening_variable_moment;
-  const MaterialProperty<RealVectorValue> & _kin_hardening_variable_moment_old;
 
-  ///Plastic strains
+  ///Plastic strains, filled from the plastic history for output
   MaterialProperty<RealVectorValue> & _plastic_strain_translational;
-  const MaterialProperty<RealVectorValue> & _plastic_strain_translational_old;
   MaterialProperty<RealVectorValue> & _plastic_strain_rotational;
-  const MaterialProperty<RealVectorValue> & _plastic_strain_rotational_old;
-
 
+  /**
+   * Consistent elastoplastic tangent in the beam local coordinate system; block [a][b] relates
+   * the forces (a = 0) or moments (a = 1) to the displacement (b = 0) or rotational (b = 1)
+   * strain increments
+   */
+  MaterialProperty<RankTwoTensor> * _elastoplastic_tangent[2][2];
 
   /// maximum no. of iterations
   const unsigned int _max_its;
+
+  /// maximum no. of step halvings in the line search
+  const unsigned int _max_line_search_its;
+
+  /// Closest point projection onto the resultant yield surface
+  BeamResultantReturnMapping _return_mapping;
+
+  /// Trial state of the return at the current qp
+  BeamResultantReturnMapping::Trial _trial;
+
+  /// 1 where the section yielded in the last increment; the whole section counts as one layer
+  MaterialProperty<Real> & _yielded_layers;
+
+  /// Local Newton iterations of the projection at each qp in the last increment
+  MaterialProperty<Real> & _return_mapping_iterations;
+
+  /// Timed sections of the hot path
+  const PerfID _compute_properties_timer;
+  const PerfID _return_map_timer;
 };
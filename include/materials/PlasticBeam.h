@@ -11,6 +11,10 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "BeamTrace.h"
+#include "BeamTimedSection.h"
+#include "BeamGeometryCache.h"
+#include "BeamMomentReturnMapping.h"
 
 /**
  * PlasticBeam defines a displacement and rotation strain increment and rotation
@@ -24,15 +28,19 @@ class Function;
 template <>
 InputParameters validParams<PlasticBeam>();
 
-class PlasticBeam : public Material
+class PlasticBeam : public Material, public BeamTraceInterface, public PerfGraphInterface
 {
 public:
   static InputParameters validParams();
 
   PlasticBeam(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual void computeProperties() override;
 
+  virtual void meshChanged() override;
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -45,11 +53,8 @@ protected:
   /// Computes the rotation matrix at time t. For small rotation scenarios, the rotation matrix at time t is same as the intiial rotation matrix
   virtual void computeRotation();
 
-  //
+  /// Computes the moment and the plastic state at the current qp, substepping if needed
   void computeQpStress();
-  virtual Real computeHardeningValue(Real scalar);
-  virtual Real computeHardeningDerivative(Real scalar);
-
 
   /// Booleans for validity of params
   const bool _has_Ix;
@@ -85,6 +90,7 @@ protected:
   const VariableValue & _Ix;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
+  /// of the current element, refreshed from the geometry cache in computeProperties()
   RankTwoTensor _original_local_config;
 
   /// Initial length of the beam
@@ -156,22 +162,21 @@ protected:
   /// Vector of old rotational eigenstrains
   std::vector<const MaterialProperty<RealVectorValue> *> _rot_eigenstrain_old;
 
-  /// Displacement and rotations at the two nodes of the beam in the global coordinate system
+  /// Displacement and rotations at the two nodes of the beam in the global coordinate system.
+  /// Like the other per element scratch members these are only valid within computeProperties();
+  /// each thread owns its own material object, so they are never shared between threads.
   RealVectorValue _disp0, _disp1, _rot0, _rot1;
 
-  /// Reference to the nonlinear system object
-  NonlinearSystemBase & _nonlinear_sys;
-  /// Indices of solution vector corresponding to displacement DOFs at the node 0
-  std::vector<unsigned int> _soln_disp_index_0;
+  /// Nodal values of the displacement variables at time t and t - dt
+  std::vector<const VariableValue *> _disp_dofs;
+  std::vector<const VariableValue *> _disp_dofs_old;
 
-  /// Indices of solution vector corresponding to displacement DOFs at the node 1
-  std::vector<unsigned int> _soln_disp_index_1;
+  /// Nodal values of the rotation variables at time t and t - dt
+  std::vector<const VariableValue *> _rot_dofs;
+  std::vector<const VariableValue *> _rot_dofs_old;
 
-  /// Indices of solution vector corresponding to rotation DOFs at the node 0
-  std::vector<unsigned int> _soln_rot_index_0;
-
-  /// Indices of solution vector corresponding to rotation DOFs at the node 1
-  std::vector<unsigned int> _soln_rot_index_1;
+  /// Cache of the element length, initial orientation and section averages
+  std::unique_ptr<BeamGeometryCache> _geometry_cache;
 
   /// Rotational transformation from global coordinate system to initial beam local configuration
   MaterialProperty<RankTwoTensor> & _initial_rotation;
@@ -197,11 +202,32 @@ protected:
   const MaterialProperty<RealVectorValue> & _moment_old;
   const MaterialProperty<RealVectorValue> & _material_flexure;
 
+  /// Algorithmic flexural tangent of the moment-curvature law
+  MaterialProperty<Real> & _flexural_tangent;
+
   MaterialProperty<Real> & _hardening_variable;
   const MaterialProperty<Real> & _hardening_variable_old;
 
   /// maximum no. of iterations
   const unsigned int _max_its;
 
+  /// Maximum number of substeps of the curvature increment
+  const unsigned int _max_substeps;
+
+  /// Number of substeps used at each qp in the last increment
+  MaterialProperty<Real> & _substeps;
+
+  /// 1 where the section yielded in the last increment; the whole section counts as one layer
+  MaterialProperty<Real> & _yielded_layers;
+
+  /// Local Newton iterations at each qp in the last increment, 0 for linear hardening
+  MaterialProperty<Real> & _return_mapping_iterations;
+
+  /// Substepped return mapping of the moment-curvature law, closed form for linear hardening
+  BeamMomentReturnMapping _return_mapping;
 
+  /// Timed sections of the hot path
+  const PerfID _compute_properties_timer;
+  const PerfID _compute_qp_stress_timer;
+  const PerfID _compute_stiffness_matrix_timer;
 };
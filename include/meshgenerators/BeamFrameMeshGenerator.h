@@ -0,0 +1,99 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+#include <array>
+
+// Forward Declarations
+class BeamFrameMeshGenerator;
+
+template <>
+InputParameters validParams<BeamFrameMeshGenerator>();
+
+/**
+ * Generates a regular 3D frame of EDGE2 beam elements: nx by ny bays in plan and nz storeys,
+ * with columns at every joint, beams along x and y at every floor and optional diagonal braces
+ * in the outer faces. nz = 0 gives a plane grid of beams. The plan may be rotated about the z
+ * axis. Each member is divided into elements_per_member elements. The member type (columns,
+ * beams_x, beams_y, braces) sets the subdomain and the section id, so sections can be assigned
+ * per block. The local y direction of every element is stored as its three components,
+ * quantized by BeamGeometryCache::quantizeOrientation(), in the extra element integers
+ * 'y_orientation_x', 'y_orientation_y' and 'y_orientation_z', which the beam materials read
+ * through y_orientation_integers.
+ *
+ * Every processor builds the whole frame, as the libMesh mesh generation functions do; a
+ * distributed mesh deletes its remote elements when it is prepared for use.
+ */
+class BeamFrameMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  BeamFrameMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Member types, used as subdomain ids
+  enum MemberType
+  {
+    COLUMN = 0,
+    BEAM_X = 1,
+    BEAM_Y = 2,
+    BRACE = 3
+  };
+
+  /// Id of the joint node at bay line i, j and floor k
+  dof_id_type joint(unsigned int i, unsigned int j, unsigned int k) const;
+
+  /**
+   * Adds the elements and interior nodes of the member between two joints
+   * @param y_orientation local y direction of the member
+   */
+  void addMember(MeshBase & mesh,
+                 dof_id_type joint0,
+                 dof_id_type joint1,
+                 MemberType type,
+                 const RealVectorValue & y_orientation);
+
+  /// Number of bays along x and y and number of storeys
+  const unsigned int _nx;
+  const unsigned int _ny;
+  const unsigned int _nz;
+
+  /// Bay widths and storey height
+  const Real _dx;
+  const Real _dy;
+  const Real _dz;
+
+  /// Number of elements along each member
+  const unsigned int _elements_per_member;
+
+  /// Whether the outer faces of each storey are braced
+  const bool _braced;
+
+  /// Plan directions of the bay lines along x and y after the rotation about z
+  const RealVectorValue _plan_x;
+  const RealVectorValue _plan_y;
+
+  /// Section id of each member type
+  const std::vector<dof_id_type> _section_ids;
+
+  /// Indices of the extra element integers
+  std::array<unsigned int, 3> _orientation_indices;
+  unsigned int _section_index;
+
+  /// Ids of the next interior node and element
+  dof_id_type _next_node_id;
+  dof_id_type _next_elem_id;
+};
@@ -0,0 +1,52 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+// Forward Declarations
+class BeamCriticalTimeStep;
+
+template <>
+InputParameters validParams<BeamCriticalTimeStep>();
+
+/**
+ * Computes the smallest stable time step of explicit central difference time integration over
+ * the beam elements, from the effective_stiffness property of the beam strain materials.
+ */
+class BeamCriticalTimeStep : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  BeamCriticalTimeStep(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  /// Density of the beam
+  const MaterialProperty<Real> & _density;
+
+  /// Pseudo stiffness, the wave speed of the beam times the square root of the density
+  const MaterialProperty<Real> & _effective_stiffness;
+
+  /// Initial length of the beam
+  const MaterialProperty<Real> & _original_length;
+
+  /// Safety factor applied to the stable time step
+  const Real _factor;
+
+  /// Smallest stable time step found so far
+  Real _critical_time;
+};
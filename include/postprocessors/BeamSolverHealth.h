@@ -0,0 +1,65 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+// Forward Declarations
+class BeamSolverHealth;
+
+template <>
+InputParameters validParams<BeamSolverHealth>();
+
+/**
+ * Reduces the per qp counters of the beam plasticity materials (yielded_layers,
+ * return_mapping_iterations and substeps) over the beam elements, or reports the number of
+ * return mappings that failed since the last execution of this postprocessor. Failed return
+ * mappings cut the time step, so they can only be counted outside of the material properties.
+ */
+class BeamSolverHealth : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  BeamSolverHealth(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  /// The reduced counter
+  enum class Quantity
+  {
+    YIELDED_LAYERS,
+    YIELDED_QPS,
+    TOTAL_ITERATIONS,
+    MAX_ITERATIONS,
+    TOTAL_SUBSTEPS,
+    MAX_SUBSTEPS,
+    FAILED_RETURN_MAPPINGS
+  };
+
+  const Quantity _quantity;
+
+  /// Per qp counter read by the element loop, nullptr for failed_return_mappings
+  const MaterialProperty<Real> * const _counter;
+
+  /// Whether the counter is reduced with a maximum instead of a sum
+  const bool _maximum;
+
+  /// Failed return mappings on this processor at the previous execution
+  unsigned long _failures_seen;
+
+  /// Value on this thread and processor
+  Real _value;
+};
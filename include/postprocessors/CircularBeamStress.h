@@ -11,6 +11,8 @@
 
 #include "GeneralPostprocessor.h"
 #include "MooseEnum.h"
+#include "BeamSectionShape.h"
+#include "BeamSectionPoint.h"
 
 // Forward Declarations
 class CircularBeamStress;
@@ -31,12 +33,18 @@ public:
 
   CircularBeamStress(const InputParameters & parameters);
 
-  virtual void initialize() override {}
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override;
   virtual void execute() override;
-  virtual void finalize() override {}
+  virtual void finalize() override;
   virtual Real getValue() override;
 
 protected:
+  /// Locates the point and caches the interpolation data of the section forces and moments
+  void locatePoint();
+
   /// A reference to the system containing the variable
   const System & _system;
 
@@ -59,4 +67,13 @@ protected:
 
   /// The value of the variable at the desired location
   Real _value;
+
+  /// Variable numbers of the section forces and moments
+  std::vector<unsigned int> _var_num;
+
+  /// Interpolation data of the section forces and moments at the point
+  BeamSectionPoint _section_point;
+
+  /// Section shape used to recover the fiber stress
+  const CircularBeamSection _section;
 };
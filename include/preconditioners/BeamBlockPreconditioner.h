@@ -0,0 +1,50 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "MoosePreconditioner.h"
+
+// Forward Declarations
+class BeamBlockPreconditioner;
+
+template <>
+InputParameters validParams<BeamBlockPreconditioner>();
+
+/**
+ * Preconditioner for systems of six DOF beam nodes. It couples the three displacement and the
+ * three rotation variables in the preconditioning matrix, so that the element K blocks of the beam
+ * kernels are assembled in full, and configures PETSc to either invert the 6x6 nodal blocks
+ * (point block Jacobi) or to split the displacement and rotation fields and precondition the
+ * Schur complement of the rotations. Both rely on the six variables forming one libMesh variable
+ * group, whose DOFs are numbered node by node. Optionally automatic variable scaling is switched
+ * on to balance the very different force and moment scales of the two fields.
+ */
+class BeamBlockPreconditioner : public MoosePreconditioner
+{
+public:
+  static InputParameters validParams();
+
+  BeamBlockPreconditioner(const InputParameters & parameters);
+
+protected:
+  /// Sets the PETSc options of the point block Jacobi preconditioner
+  void setNodalBlockOptions();
+
+  /// Sets the PETSc options of the displacement/rotation Schur complement split
+  void setSchurOptions();
+
+  /// Position of each displacement and rotation variable within the nodal block
+  std::vector<unsigned int> _disp_fields;
+  std::vector<unsigned int> _rot_fields;
+
+  /// Number of DOFs per node
+  unsigned int _block_size;
+};
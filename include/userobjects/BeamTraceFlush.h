@@ -0,0 +1,32 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * BeamTraceFlush writes the beam trace buffers of all threads on demand, i.e., at the times given
+ * by execute_on. Each processor writes its own buffers.
+ */
+class BeamTraceFlush : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  BeamTraceFlush(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Base name of the per-processor trace files, the buffers go to the error stream if empty
+  const std::string _file_base;
+};
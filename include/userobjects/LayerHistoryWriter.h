@@ -0,0 +1,86 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "LayeredBeamState.h"
+#include "LayerHistoryFile.h"
+
+#include <map>
+#include <memory>
+
+/**
+ * LayerHistoryWriter streams the layer values of the LayeredBeamState material property of every
+ * element to one chunked binary file, see LayerHistoryFile for the format. It replaces one
+ * LayeredBeamStateAux variable per layer and quantity when the full section history is wanted.
+ * Elements and time steps can be downsampled. The values are gathered to the first processor,
+ * which packs, optionally compresses and writes them on a background thread while the solve
+ * continues. At final the writer waits for that thread, so the file is complete once the solve
+ * ends. The stresses of compact states are recovered from the stored stress gradient and
+ * the fiber distances of the LayeredBeam declaring the property.
+ */
+class LayerHistoryWriter : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  LayerHistoryWriter(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  /// Fiber distances of the section of the current element
+  const std::vector<Real> & layerZ();
+
+  /// Layered section state of each qp
+  const MaterialProperty<LayeredBeamState> & _layer_state;
+
+  /// Quantities written for each layer, in file order
+  std::vector<unsigned int> _quantities;
+
+  /// Only elements whose id is a multiple of this are written
+  const unsigned int _element_interval;
+
+  /// Only time steps that are a multiple of this are written
+  const unsigned int _time_interval;
+
+  /// Whether the values are stored as float32 instead of float64
+  const bool _single_precision;
+
+  /// zlib compression level of the chunks, 0 for none
+  const unsigned int _compression_level;
+
+  /// Number of chunks that may wait for the writer thread
+  const unsigned int _buffer_chunks;
+
+  /// Name of the history file
+  const std::string _file_name;
+
+  /// Whether the current time step is written
+  bool _active;
+
+  /// Layers and qps per element seen on this thread, 0 before the first element
+  unsigned int _nlayers;
+  unsigned int _nqps;
+
+  /// Element ids and values collected for the current chunk
+  std::vector<uint64_t> _elem_ids;
+  std::vector<Real> _values;
+
+  /// Fiber distances of each block, looked up on first use
+  std::map<SubdomainID, const std::vector<Real> *> _layer_z;
+
+  /// File written by the first processor, opened once the layer count is known
+  std::unique_ptr<LayerHistoryFile> _file;
+};
@@ -0,0 +1,174 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+#include "RankTwoTensor.h"
+
+#include <unordered_map>
+
+/**
+ * Cross-section properties averaged over the two nodes of a beam element
+ */
+struct BeamSectionAverages
+{
+  Real area;
+  Real Iy;
+  Real Iz;
+  Real Ix;
+};
+
+/**
+ * Small strain stiffness blocks of a beam element in the global coordinate system, together with
+ * the moduli and the orientation they were built with
+ */
+struct BeamStiffnessBlocks
+{
+  RankTwoTensor K11;
+  RankTwoTensor K21;
+  RankTwoTensor K22;
+  RankTwoTensor K22_cross;
+
+  Real youngs_modulus;
+  Real shear_modulus;
+  Real flexural_rigidity;
+  RankTwoTensor rotation;
+  bool valid;
+};
+
+/**
+ * Time independent data of a single beam element
+ */
+struct BeamElementGeometry
+{
+  /// Initial length of the element
+  Real original_length;
+
+  /// Rotational transformation from global coordinate system to initial beam local configuration
+  RankTwoTensor original_local_config;
+
+  /// Averaged section properties, only valid if has_section is set
+  BeamSectionAverages section;
+  bool has_section;
+
+  /// Small strain stiffness blocks, only valid if stiffness.valid is set
+  BeamStiffnessBlocks stiffness;
+};
+
+// Forward Declarations
+class MooseObject;
+namespace libMesh
+{
+class MeshBase;
+}
+
+/**
+ * Per element cache of the beam geometry used by the beam strain materials. An entry is built on
+ * the first visit to an element and reused for all later residual and Jacobian evaluations. The
+ * owning material must call clear() when the mesh changes.
+ *
+ * The local y direction of the beams is either one vector for all elements (y_orientation) or
+ * read per element from three extra element integers holding its quantized components
+ * (y_orientation_integers), as written by BeamFrameMeshGenerator.
+ */
+class BeamGeometryCache
+{
+public:
+  /// Parameters of the local y direction, added to the parameters of the owning material
+  static InputParameters validParams();
+
+  /**
+   * @param object owning object, whose parameters include validParams()
+   * @param mesh mesh holding the extra element integers
+   * @param ndisp number of displacement components
+   * @param constant_section whether the section properties are constant in time
+   */
+  BeamGeometryCache(const MooseObject & object,
+                    const MeshBase & mesh,
+                    unsigned int ndisp,
+                    bool constant_section);
+
+  /// Geometry of elem, built on first access
+  const BeamElementGeometry & geometry(const Elem * elem);
+
+  /**
+   * Section properties of elem averaged over its nodes. They are cached if the section is
+   * constant and recomputed from the supplied values otherwise.
+   */
+  const BeamSectionAverages & section(const Elem * elem,
+                                      const VariableValue & area,
+                                      const VariableValue & Iy,
+                                      const VariableValue & Iz,
+                                      const VariableValue & Ix,
+                                      bool has_Ix);
+
+  /**
+   * Small strain stiffness blocks of elem. With a constant section they are cached and only
+   * rebuilt when one of the moduli or the rotation differs from the ones they were built with,
+   * i.e. when the elasticity prefactor or the plastic tangent of the section changes.
+   * @param section section averages of elem
+   * @param youngs_modulus Young's modulus
+   * @param shear_modulus shear modulus
+   * @param flexural_rigidity bending rigidity about the local z axis, E * Iy for an elastic
+   * section and the averaged algorithmic tangent for a plastic one
+   * @param rotation rotational transformation from global to beam local coordinate system
+   */
+  const BeamStiffnessBlocks & stiffness(const Elem * elem,
+                                        const BeamSectionAverages & section,
+                                        Real youngs_modulus,
+                                        Real shear_modulus,
+                                        Real flexural_rigidity,
+                                        const RankTwoTensor & rotation);
+
+  /// Drops all entries, must be called when the mesh changes
+  void clear() { _cache.clear(); }
+
+  /// Extra element integer value of a direction component in [-1, 1]
+  static dof_id_type quantizeOrientation(Real component);
+
+  /// Direction component of an extra element integer value written by quantizeOrientation()
+  static Real orientationComponent(dof_id_type value);
+
+protected:
+  /// Entry of elem, built on first access
+  BeamElementGeometry & entry(const Elem * elem);
+
+  /// Computes the entry of elem
+  void build(const Elem * elem, BeamElementGeometry & geometry) const;
+
+  /// Computes the stiffness blocks of an element of the given length
+  void buildStiffness(Real length,
+                      const BeamSectionAverages & section,
+                      Real youngs_modulus,
+                      Real shear_modulus,
+                      Real flexural_rigidity,
+                      const RankTwoTensor & rotation,
+                      BeamStiffnessBlocks & blocks) const;
+
+  const std::string _name;
+  const unsigned int _ndisp;
+
+  /// Local y direction of all elements, unused with an orientation integer
+  RealGradient _y_orientation;
+
+  /// Indices of the extra element integers holding the components of the local y direction
+  std::vector<unsigned int> _orientation_integers;
+
+  const bool _constant_section;
+
+  std::unordered_map<dof_id_type, BeamElementGeometry> _cache;
+
+  /// Storage for section averages that cannot be cached
+  BeamSectionAverages _section_scratch;
+
+  /// Storage for stiffness blocks that cannot be cached
+  BeamStiffnessBlocks _stiffness_scratch;
+};
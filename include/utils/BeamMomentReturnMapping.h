@@ -0,0 +1,116 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "HardeningCurve.h"
+
+/**
+ * Return mapping of the moment-curvature law of PlasticBeam with isotropic hardening, either
+ * linear or tabulated. A curvature increment is integrated in adaptive substeps. This does not
+ * depend on the material system, so one increment can be driven on its own.
+ */
+class BeamMomentReturnMapping
+{
+public:
+  /// Moment, hardening variable and plastic curvature at one qp
+  struct State
+  {
+    Real moment;
+    Real hardening;
+    Real plastic_strain;
+  };
+
+  /**
+   * @param yield_moment moment at which plastic curvature starts accumulating
+   * @param hardening_constant linear hardening slope, unused once a hardening curve is built
+   * @param max_substeps maximum number of substeps of one curvature increment
+   * @param substep_tolerance relative moment error above which a substep is halved
+   */
+  BeamMomentReturnMapping(Real yield_moment,
+                          Real hardening_constant,
+                          Real absolute_tolerance,
+                          Real relative_tolerance,
+                          unsigned int max_iterations,
+                          unsigned int max_substeps,
+                          Real substep_tolerance);
+
+  /// Hardening curve of the tabulated law; the law is linear as long as the curve is empty
+  HardeningCurve & hardeningCurve() { return _hardening_curve; }
+
+  /**
+   * Integrates a curvature increment starting from state, which is updated in place. Returns
+   * false if the increment does not converge within max_substeps substeps, in which case state
+   * is left at the start of the increment.
+   */
+  bool integrate(Real flexural_rigidity, Real curvature_increment, State & state);
+
+  /// Plastic curvature increment of the last integrated increment
+  Real plasticIncrement() const { return _plastic_increment; }
+
+  /**
+   * Algorithmic flexural tangent of the last integrated increment: the derivative of its moment
+   * with respect to its curvature increment, chained through all of its substeps
+   */
+  Real flexuralTangent() const { return _flexural_tangent; }
+
+  /// Substeps used by the last integrated increment
+  unsigned int substeps() const { return _substeps; }
+
+  /// Newton iterations of the last integrated increment, summed over its substeps
+  unsigned int iterations() const { return _iterations; }
+
+protected:
+  /**
+   * Return mapping of one substep, which also advances the derivatives of the state with respect
+   * to the curvature increment of the step; returns false if the Newton iteration does not
+   * converge
+   * @param increment_fraction fraction of the curvature increment of the step in the substep
+   */
+  bool integrateSubstep(Real flexural_rigidity,
+                        Real curvature_increment,
+                        Real increment_fraction,
+                        State & state,
+                        Real & plastic_increment);
+
+  /// Hardening variable and its slope at plastic multiplier scalar within the current substep
+  void computeHardening(Real scalar, Real & hardening, Real & slope) const;
+
+  const Real _yield_moment;
+  const Real _hardening_constant;
+
+  /// Tabulated hardening_function
+  HardeningCurve _hardening_curve;
+
+  /// convergence tolerance
+  const Real _absolute_tolerance;
+  const Real _relative_tolerance;
+
+  /// maximum no. of iterations
+  const unsigned int _max_its;
+
+  /// Maximum number of substeps of the curvature increment
+  const unsigned int _max_substeps;
+
+  /// Relative moment error above which a substep is halved
+  const Real _substep_tolerance;
+
+  /// Hardening variable and plastic strain at the start of the current substep
+  Real _substep_hardening;
+  Real _substep_plastic_strain;
+
+  /// Derivatives of the state with respect to the curvature increment of the step
+  State _state_derivative;
+
+  /// Results of the last integrated increment
+  Real _plastic_increment;
+  Real _flexural_tangent;
+  unsigned int _substeps;
+  unsigned int _iterations;
+};
@@ -0,0 +1,136 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+
+/**
+ * Closest point projection onto the stress resultant yield surface of NonlinearBeam, with mixed
+ * isotropic and kinematic hardening. The generalized stresses are ordered as
+ * (F_x, F_y, F_z, M_x, M_y, M_z); only F_x and the three moments enter the yield function.
+ * This does not depend on the material system, so one return can be driven on its own.
+ */
+class BeamResultantReturnMapping
+{
+public:
+  /// Generalized stress array
+  typedef std::array<Real, 6> Vector;
+
+  /// Matrix over the generalized stress components
+  typedef std::array<Vector, 6> Matrix;
+
+  /// State at the start of a return, all ordered as the generalized stresses
+  struct Trial
+  {
+    /// Elastic trial stress
+    Vector stress;
+    /// Elastic modulus of each component
+    Vector modulus;
+    /// Initial yield value of each component
+    Vector yield;
+    /// Isotropic hardening variables at the last converged step
+    Vector kappa_old;
+    /// Back stresses at the last converged step
+    Vector alpha_old;
+  };
+
+  /**
+   * @param isotropic_hardening increase of the yield value per unit change of a component
+   * @param kinematic_hardening back stress change per unit change of a component
+   */
+  BeamResultantReturnMapping(Real isotropic_hardening,
+                             Real kinematic_hardening,
+                             Real absolute_tolerance,
+                             Real relative_tolerance,
+                             unsigned int max_iterations,
+                             unsigned int max_line_search_iterations);
+
+  /// Yield condition of the trial state, positive if the return is needed
+  Real trialYield(const Trial & trial);
+
+  /**
+   * Projects the trial stress onto the yield surface and computes the consistent tangent.
+   * Returns false if the projection does not converge within the iteration limit.
+   */
+  bool returnMap(const Trial & trial);
+
+  /// Converged generalized stresses
+  const Vector & stress() const { return _stress; }
+
+  /**
+   * Consistent elastoplastic tangent: tangent()[i][j] is the derivative of the converged
+   * generalized stress i with respect to the generalized strain increment j, whose elastic
+   * stress increment is modulus[j] times the strain increment. Components outside the yield
+   * function stay elastic.
+   */
+  const Matrix & tangent() const { return _tangent; }
+
+  /// Newton iterations of the last return
+  unsigned int iterations() const { return _iterations; }
+
+  /// Isotropic hardening per unit change of a component
+  Real isotropicHardening() const { return _isotropic_hardening; }
+
+  /// Kinematic hardening per unit change of a component
+  Real kinematicHardening() const { return _kinematic_hardening; }
+
+  /// Generalized stress components entering the yield function (F_x, M_x, M_y, M_z)
+  static constexpr std::array<unsigned int, 4> active_components = {{0, 3, 4, 5}};
+
+protected:
+  /// Yield function term of one generalized stress component and its derivatives
+  struct YieldTerm
+  {
+    Real phi;
+    Real n;
+    Real dn_dstress;
+    Real dphi_dstress;
+    Real dn_dtrial;
+    Real dphi_dtrial;
+  };
+
+  /// Yield function term of component i at the given stress, with hardening from the return
+  YieldTerm yieldTerm(unsigned int i, Real stress) const;
+
+  /// Yield condition at the given generalized stresses
+  Real evaluateYield(const Vector & stress) const;
+
+  /// Fills _residual and _residual_yield and returns the merit function of the return mapping
+  Real computeResidual(const Vector & stress, Real lambda);
+
+  /// Consistent elastoplastic tangent at the converged return
+  void computeTangent(Real lambda);
+
+  const Real _isotropic_hardening;
+  const Real _kinematic_hardening;
+
+  /// convergence tolerance
+  const Real _absolute_tolerance;
+  const Real _relative_tolerance;
+
+  /// maximum no. of iterations
+  const unsigned int _max_its;
+
+  /// maximum no. of step halvings in the line search
+  const unsigned int _max_line_search_its;
+
+  /// Trial state of the current return
+  const Trial * _trial;
+
+  /// Scratch data of the return mapping
+  Vector _stress;
+  Matrix _tangent;
+  Vector _residual;
+  Vector _diagonal;
+  Real _residual_yield;
+  unsigned int _iterations;
+};
@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "DataIO.h"
+
+/**
+ * Per quadrature point plastic history of a NonlinearBeam section: the isotropic and kinematic
+ * hardening variables and the plastic strain of each generalized stress component, ordered as
+ * (F_x, F_y, F_z, M_x, M_y, M_z). Nothing is stored until the section first yields, so the
+ * stateful storage of an elastic qp is an empty vector; every value of such a state reads zero.
+ */
+class BeamResultantState
+{
+public:
+  /// Quantities stored for each component, in storage order
+  enum Quantity
+  {
+    ISOTROPIC_HARDENING = 0,
+    KINEMATIC_HARDENING = 1,
+    PLASTIC_STRAIN = 2
+  };
+
+  /// Number of generalized stress components
+  static constexpr unsigned int n_components = 6;
+
+  /// Releases the stored values, leaving a state that has never yielded
+  void clear() { std::vector<Real>().swap(_data); }
+
+  /// Whether the section has yielded and its values are stored
+  bool allocated() const { return !_data.empty(); }
+
+  /// Stores zero values, called when the section first yields
+  void allocate() { _data.assign(3 * n_components, 0.0); }
+
+  /// Value of one quantity and component, zero for a state that has never yielded
+  Real value(Quantity q, unsigned int component) const
+  {
+    return _data.empty() ? 0.0 : _data[q * n_components + component];
+  }
+
+  /// Writable value of an allocated state
+  Real & value(Quantity q, unsigned int component) { return _data[q * n_components + component]; }
+
+  /// Raw storage for restart
+  std::vector<Real> & data() { return _data; }
+  const std::vector<Real> & data() const { return _data; }
+
+protected:
+  /// Packed values, n_components per quantity; empty until the section yields
+  std::vector<Real> _data;
+};
+
+template <>
+void dataStore(std::ostream & stream, BeamResultantState & state, void * context);
+template <>
+void dataLoad(std::istream & stream, BeamResultantState & state, void * context);
@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/vector_value.h"
+
+namespace libMesh
+{
+class PointLocatorBase;
+class System;
+}
+
+/**
+ * Interpolation data of the six section force and moment variables at one point along a beam.
+ * locate() finds the element containing the point once and caches its shape function values and
+ * DOF indices on the processor that owns it, so the values can be evaluated repeatedly without a
+ * point location per variable and per evaluation.
+ */
+class BeamSectionPoint
+{
+public:
+  /**
+   * @param system the system holding the section force and moment variables
+   * @param var_num variable numbers of the three forces followed by the three moments
+   */
+  BeamSectionPoint(const System & system, const std::vector<unsigned int> & var_num);
+
+  /**
+   * Locates point and caches its interpolation data if the containing element is owned by this
+   * processor. Collective: every processor has to call it. Returns false if no element contains
+   * the point.
+   */
+  bool locate(PointLocatorBase & locator, const Point & point);
+
+  /// Whether the point lies in an element owned by this processor
+  bool isLocal() const { return _local; }
+
+  /// Section forces and moments at the point from the current solution; only valid if isLocal()
+  void evaluate(RealVectorValue & force, RealVectorValue & moment) const;
+
+protected:
+  /// The system holding the section force and moment variables
+  const System & _system;
+
+  /// Variable numbers of the section forces and moments
+  const std::vector<unsigned int> & _var_num;
+
+  /// Whether the point lies in an element owned by this processor
+  bool _local;
+
+  /// Shape function values at the point, per force and moment variable
+  std::vector<std::vector<Real>> _phi;
+
+  /// DOF indices of the element containing the point, per force and moment variable
+  std::vector<std::vector<dof_id_type>> _dof_indices;
+};
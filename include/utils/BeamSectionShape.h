@@ -0,0 +1,101 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/vector_value.h"
+
+/**
+ * Cross-section shape used to recover fiber stresses from the beam section forces and moments.
+ * Fibers are addressed by two shape specific location parameters, which fiber() maps to the
+ * local (y, z) coordinates measured from the section centroid.
+ */
+class BeamSectionShape
+{
+public:
+  virtual ~BeamSectionShape() = default;
+
+  /// Local (y, z) coordinates of the fiber given by the two location parameters
+  virtual void fiber(Real location_1, Real location_2, Real & y, Real & z) const = 0;
+
+  /**
+   * Stress component (11, 12 or 13) at fiber (y, z)
+   * @param force section forces (axial, shear along y, shear along z)
+   * @param moment section moments (torsion, about y, about z)
+   */
+  virtual Real stress(unsigned int component,
+                      const RealVectorValue & force,
+                      const RealVectorValue & moment,
+                      Real y,
+                      Real z) const = 0;
+};
+
+/**
+ * Solid circular section. Fibers are located by the relative radius (0 at the center, 1 at the
+ * edge) and the angle in degrees.
+ */
+class CircularBeamSection : public BeamSectionShape
+{
+public:
+  CircularBeamSection(Real radius);
+
+  virtual void fiber(Real r_location, Real theta, Real & y, Real & z) const override;
+  virtual Real stress(unsigned int component,
+                      const RealVectorValue & force,
+                      const RealVectorValue & moment,
+                      Real y,
+                      Real z) const override;
+
+protected:
+  const Real _radius;
+};
+
+/**
+ * Circular hollow section. Fibers are located by the relative position through the wall (0 at the
+ * inner edge, 1 at the outer edge) and the angle in degrees.
+ */
+class PipeBeamSection : public BeamSectionShape
+{
+public:
+  PipeBeamSection(Real outer_radius, Real thickness);
+
+  virtual void fiber(Real r_location, Real theta, Real & y, Real & z) const override;
+  virtual Real stress(unsigned int component,
+                      const RealVectorValue & force,
+                      const RealVectorValue & moment,
+                      Real y,
+                      Real z) const override;
+
+protected:
+  const Real _ro;
+  const Real _thickness;
+  const Real _ri;
+};
+
+/**
+ * Solid rectangular section. Fibers are located by the relative position along the depth (0 at
+ * the bottom, 1 at the top) and along the width (0 at the left, 1 at the right).
+ */
+class RectangularBeamSection : public BeamSectionShape
+{
+public:
+  RectangularBeamSection(Real depth, Real width);
+
+  virtual void fiber(Real y_location, Real z_location, Real & y, Real & z) const override;
+  virtual Real stress(unsigned int component,
+                      const RealVectorValue & force,
+                      const RealVectorValue & moment,
+                      Real y,
+                      Real z) const override;
+
+protected:
+  const Real _depth;
+  const Real _width;
+};
@@ -0,0 +1,25 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+/**
+ * Processor wide counters of events of the beam constitutive updates that do not survive in
+ * material properties. A failed return mapping throws and the solve is repeated with a smaller
+ * time step, so the failure is counted here and read back by the BeamSolverHealth postprocessor.
+ * The counters may be incremented from any thread.
+ */
+namespace BeamSolverCounters
+{
+/// Counts a return mapping that did not converge
+void recordFailedReturnMapping();
+
+/// Number of failed return mappings on this processor since the start of the run
+unsigned long failedReturnMappings();
+}
@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "PerfGraphInterface.h"
+#include "PerfGuard.h"
+
+#include <new>
+#include <type_traits>
+
+/**
+ * Times a section of a threaded beam object. The PerfGraph is not thread safe, so only the
+ * object owned by the master thread is timed; with threads the section shows the share of the
+ * work done on thread 0. Unlike TIME_SECTION the guard is constructed in place, so objects on
+ * the other threads pay for a single branch.
+ */
+class BeamTimedSection
+{
+public:
+  BeamTimedSection(PerfGraph & graph, PerfID id, bool active) : _active(active)
+  {
+    if (_active)
+      new (&_storage) PerfGuard(graph, id);
+  }
+
+  ~BeamTimedSection()
+  {
+    if (_active)
+      reinterpret_cast<PerfGuard *>(&_storage)->~PerfGuard();
+  }
+
+  BeamTimedSection(const BeamTimedSection &) = delete;
+  BeamTimedSection & operator=(const BeamTimedSection &) = delete;
+
+private:
+  const bool _active;
+  typename std::aligned_storage<sizeof(PerfGuard), alignof(PerfGuard)>::type _storage;
+};
+
+/// Times the rest of the enclosing scope in an object deriving from PerfGraphInterface
+#define BEAM_TIME_SECTION(id) BeamTimedSection beam_time_guard(this->_perf_graph, id, _tid == 0)
@@ -0,0 +1,154 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+#include "InputParameters.h"
+
+#include <set>
+#include <sstream>
+
+class MooseObject;
+
+/**
+ * The beam trace channel is only compiled into builds with assertions enabled (dbg and devel).
+ * In opt builds every beamTrace() call expands to nothing and its arguments are never evaluated.
+ */
+#ifndef NDEBUG
+#define OTTER_BEAM_TRACE 1
+#else
+#define OTTER_BEAM_TRACE 0
+#endif
+
+#if OTTER_BEAM_TRACE
+#define beamTrace(elem_id, qp, ...)                                                                \
+  do                                                                                               \
+  {                                                                                                \
+    if (traceEnabled(elem_id, qp))                                                                 \
+      traceRecord(elem_id, qp, __VA_ARGS__);                                                       \
+  } while (0)
+#else
+#define beamTrace(elem_id, qp, ...)                                                                \
+  do                                                                                               \
+  {                                                                                                \
+  } while (0)
+#endif
+
+/**
+ * A single entry of the beam trace channel
+ */
+struct BeamTraceRecord
+{
+  /// Name of the object that produced the record
+  std::string object;
+
+  /// Element the record belongs to
+  dof_id_type elem_id;
+
+  /// Quadrature point the record belongs to (libMesh::invalid_uint for element level records)
+  unsigned int qp;
+
+  /// Formatted message
+  std::string message;
+};
+
+/**
+ * Bounded ring buffer of trace records. Once the buffer is full the oldest records are
+ * overwritten, so the buffer always holds the history leading up to the latest event.
+ */
+class BeamTraceBuffer
+{
+public:
+  BeamTraceBuffer(std::size_t capacity);
+
+  /// Appends a record, overwriting the oldest one if the buffer is full
+  void push(BeamTraceRecord && record);
+
+  /// Writes the buffered records from oldest to newest and empties the buffer
+  void flush(std::ostream & os);
+
+  /// Grows the buffer to hold at least capacity records. Buffered records are discarded.
+  void reserve(std::size_t capacity);
+
+  std::size_t size() const { return _size; }
+
+private:
+  std::vector<BeamTraceRecord> _records;
+
+  /// Index of the oldest record
+  std::size_t _head;
+
+  /// Number of valid records
+  std::size_t _size;
+
+  /// Number of records overwritten since the last flush
+  std::size_t _dropped;
+};
+
+namespace BeamTrace
+{
+/// Creates (or grows) one buffer per thread. Must be called from serial code.
+void initialize(std::size_t capacity);
+
+/// The trace buffer owned by thread tid
+BeamTraceBuffer & buffer(THREAD_ID tid);
+
+/// Flushes the buffers of all threads on this processor
+void flushAll(std::ostream & os);
+}
+
+/**
+ * Interface for objects writing to the beam trace channel. Tracing is enabled per object from the
+ * input file and can be restricted to a subset of element ids and quadrature points.
+ */
+class BeamTraceInterface
+{
+public:
+  static InputParameters validParams();
+
+  BeamTraceInterface(const MooseObject * moose_object);
+
+protected:
+  /// Whether records for the given element and qp (invalid_uint for element records) are kept
+  bool traceEnabled(dof_id_type elem_id, unsigned int qp) const;
+
+  /// Formats the arguments into a record on this thread's buffer, use through beamTrace()
+  template <typename... Args>
+  void traceRecord(dof_id_type elem_id, unsigned int qp, Args &&... args) const;
+
+  /// Dumps this thread's trace buffer to Moose::err, called right before throwing a MooseException
+  void traceFlush() const;
+
+private:
+  /// Name used to tag records of this object
+  const std::string _trace_name;
+
+  /// Whether this object writes to the trace channel
+  const bool _trace;
+
+  /// Element ids to trace, all elements if empty
+  std::set<dof_id_type> _trace_elements;
+
+  /// Quadrature points to trace, all qps if empty
+  std::set<unsigned int> _trace_qps;
+
+  /// Thread id of the owning object
+  const THREAD_ID _trace_tid;
+};
+
+template <typename... Args>
+void
+BeamTraceInterface::traceRecord(dof_id_type elem_id, unsigned int qp, Args &&... args) const
+{
+  std::ostringstream ss;
+  moose::internal::mooseStreamAll(ss, std::forward<Args>(args)...);
+  BeamTrace::buffer(_trace_tid).push({_trace_name, elem_id, qp, ss.str()});
+}
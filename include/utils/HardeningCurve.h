@@ -0,0 +1,108 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+
+#include <algorithm>
+#include <functional>
+
+class Function;
+
+/**
+ * Piecewise linear table of a hardening function of plastic strain. A PiecewiseLinear function
+ * is converted using its own breakpoints, any other function is sampled at uniform spacing that
+ * is refined until linear interpolation reproduces the function to a given tolerance. Value and
+ * slope are returned together without going through the virtual Function interface.
+ */
+class HardeningCurve
+{
+public:
+  /// Parameters controlling the sampling of non-piecewise-linear hardening functions
+  static InputParameters validParams();
+
+  HardeningCurve() : _uniform(false), _extrapolate(false), _inverse_spacing(0.0) {}
+
+  /**
+   * Tabulates the function; must be called once the function has been set up
+   * @param function hardening function, with plastic strain as its time argument
+   * @param npoints initial number of sampling points used if the function is not piecewise linear
+   * @param max_strain upper end of the sampled plastic strain range
+   * @param tolerance interpolation error allowed in a sampled table, relative to the largest
+   * tabulated value
+   */
+  void build(const Function & function, unsigned int npoints, Real max_strain, Real tolerance);
+
+  /**
+   * Tabulates piecewise linear data given by its breakpoints. Outside of them the curve is
+   * constant, or continued with the slope of the first and last segment if extrapolate is set.
+   */
+  void build(const std::vector<Real> & x,
+             const std::vector<Real> & value,
+             bool extrapolate = false);
+
+  /**
+   * Samples function at uniform spacing on [0, max_strain], starting from npoints points and
+   * doubling the number of segments until the interpolation error at the segment midpoints is
+   * within tolerance times the largest tabulated value. The table is linearly extrapolated.
+   */
+  void buildUniform(const std::function<Real(Real)> & function,
+                    unsigned int npoints,
+                    Real max_strain,
+                    Real tolerance);
+
+  /// Number of breakpoints of the table
+  std::size_t size() const { return _x.size(); }
+
+  /// Whether build() has been called
+  bool empty() const { return _x.empty(); }
+
+  /// Value and slope of the hardening curve at plastic strain x
+  void evaluate(Real x, Real & value, Real & slope) const
+  {
+    const std::size_t n_segments = _slope.size();
+
+    std::size_t k;
+    if (_uniform)
+      k = x <= _x[0] ? 0 : std::min(std::size_t((x - _x[0]) * _inverse_spacing), n_segments - 1);
+    else
+      k = std::upper_bound(_x.begin() + 1, _x.end() - 1, x) - _x.begin() - 1;
+
+    // outside the table the curve is either constant or continued with the end slopes
+    if (!_extrapolate && (x < _x.front() || x > _x.back()))
+    {
+      value = x < _x.front() ? _value.front() : _value.back();
+      slope = 0.0;
+      return;
+    }
+
+    slope = _slope[k];
+    value = _value[k] + slope * (x - _x[k]);
+  }
+
+private:
+  /// Fills the segment slopes from the breakpoints and values
+  void computeSlopes();
+
+  /// Breakpoints, values at the breakpoints and slope of each segment
+  std::vector<Real> _x;
+  std::vector<Real> _value;
+  std::vector<Real> _slope;
+
+  /// Whether the breakpoints are uniformly spaced
+  bool _uniform;
+
+  /// Whether the curve is linearly extrapolated beyond the table
+  bool _extrapolate;
+
+  /// Inverse of the breakpoint spacing of a uniform table
+  Real _inverse_spacing;
+};
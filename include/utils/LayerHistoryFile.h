@@ -0,0 +1,126 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Chunked binary file of per element, per layer beam states, written from a background thread.
+ * All integers and values are stored in the native (little endian) byte order.
+ *
+ * The file starts with a header
+ *   char[8]  magic "OTLHIST1"
+ *   uint32   number of layers
+ *   uint32   number of qps per element
+ *   uint32   number of quantities, followed by one uint32 quantity id each
+ *            (LayeredBeamState::Quantity: 0 stress, 1 plastic strain, 2 hardening variable)
+ *   uint32   bytes per value, 4 or 8
+ *   uint32   zlib compression level, 0 if the chunks are not compressed
+ * followed by one chunk per written time step
+ *   float64  time
+ *   int64    time step
+ *   uint64   number of elements
+ *   uint64   stored payload bytes
+ *   uint64   uncompressed payload bytes
+ *   payload  uint64 element ids, then the values ordered by element, qp, quantity and layer
+ *
+ * scripts/read_layer_history.py reads this format.
+ */
+class LayerHistoryFile
+{
+public:
+  /// Layout of the values in every chunk of the file
+  struct Layout
+  {
+    unsigned int n_layers;
+    unsigned int n_qps;
+    std::vector<unsigned int> quantities;
+    bool single_precision;
+    unsigned int compression_level;
+  };
+
+  /**
+   * Opens the file and writes its header
+   * @param max_pending number of chunks that may wait for the writer thread before write() blocks
+   */
+  LayerHistoryFile(const std::string & file_name, const Layout & layout, unsigned int max_pending);
+
+  /// Writes all pending chunks and closes the file
+  ~LayerHistoryFile();
+
+  /**
+   * Queues one chunk for writing. The chunk is packed, compressed and written by the writer
+   * thread, so this returns as soon as there is room in the queue.
+   * @param values layout.n_qps * layout.quantities.size() * layout.n_layers values per element
+   */
+  void write(Real time,
+             int time_step,
+             std::vector<uint64_t> && elem_ids,
+             std::vector<Real> && values);
+
+  /// Blocks until all queued chunks are written
+  void flush();
+
+  /// Whether zlib compression is available in this build
+  static bool compressionAvailable();
+
+protected:
+  struct Chunk
+  {
+    Real time;
+    int time_step;
+    std::vector<uint64_t> elem_ids;
+    std::vector<Real> values;
+  };
+
+  /// Loop of the writer thread
+  void run();
+
+  /// Packs, compresses and writes one chunk, called on the writer thread
+  void writeChunk(const Chunk & chunk);
+
+  /// Throws if the writer thread failed
+  void checkError();
+
+  const std::string _file_name;
+  const Layout _layout;
+  const unsigned int _max_pending;
+
+  std::ofstream _file;
+
+  /// Chunks waiting for the writer thread, and whether one is being written
+  std::deque<Chunk> _queue;
+  bool _busy;
+
+  /// Set by the destructor to stop the writer thread once the queue is empty
+  bool _done;
+
+  /// Error raised on the writer thread, reported by the next call on the main thread
+  std::string _error;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+
+  /// Packing and compression buffers of the writer thread
+  std::vector<char> _raw;
+  std::vector<char> _compressed;
+
+  std::thread _thread;
+};
@@ -0,0 +1,115 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "DataIO.h"
+#include "MooseError.h"
+
+/**
+ * Per quadrature point history of a layered beam section. The stress, plastic strain and
+ * hardening variable of every layer live in one contiguous buffer laid out as
+ * [stress_0 .. stress_n-1 | plastic_strain_0 .. plastic_strain_n-1 | hardening_0 .. hardening_n-1],
+ * so a layer loop streams through memory and copying the old state is a single block copy.
+ *
+ * A section that has never yielded can be held in compact form instead: no layer values are
+ * stored, only the bending stress per unit distance from the centroid, from which the stress of
+ * every layer follows as its fiber distance times that gradient. Plastic strain and hardening
+ * are zero. expand() allocates the layer values once the section first yields.
+ */
+class LayeredBeamState
+{
+public:
+  /// Quantities stored for each layer, in storage order
+  enum Quantity
+  {
+    STRESS = 0,
+    PLASTIC_STRAIN = 1,
+    HARDENING = 2
+  };
+
+  /// Number of quantities stored per layer
+  static constexpr unsigned int n_quantities = 3;
+
+  LayeredBeamState() : _nlayers(0), _stress_gradient(0.0) {}
+
+  /// Sets the number of layers and zeroes all layer values
+  void resize(unsigned int nlayers)
+  {
+    _nlayers = nlayers;
+    _data.assign(n_quantities * nlayers, 0.0);
+    _stress_gradient = 0.0;
+  }
+
+  /// Sets the number of layers of a compact, unstressed state without storing any layer values
+  void resizeCompact(unsigned int nlayers)
+  {
+    _nlayers = nlayers;
+    std::vector<Real>().swap(_data);
+    _stress_gradient = 0.0;
+  }
+
+  /// Number of layers held by this state
+  unsigned int layers() const { return _nlayers; }
+
+  /// Whether the layer values are not stored because the section has never yielded
+  bool compact() const { return _data.empty() && _nlayers; }
+
+  /// Bending stress per unit fiber distance of a compact state
+  Real & stressGradient() { return _stress_gradient; }
+  Real stressGradient() const { return _stress_gradient; }
+
+  /**
+   * Stores the layer values of a compact state
+   * @param z fiber distance of each layer from the centroid
+   */
+  void expand(const std::vector<Real> & z)
+  {
+    mooseAssert(z.size() == _nlayers, "One fiber distance is needed per layer");
+    _data.assign(n_quantities * _nlayers, 0.0);
+    for (unsigned int i = 0; i < _nlayers; ++i)
+      _data[i] = _stress_gradient * z[i];
+    _stress_gradient = 0.0;
+  }
+
+  /// Contiguous array of one quantity over all layers
+  Real * begin(Quantity q) { return _data.data() + q * _nlayers; }
+  const Real * begin(Quantity q) const { return _data.data() + q * _nlayers; }
+
+  /// Layer values
+  Real & stress(unsigned int layer) { return _data[layer]; }
+  Real stress(unsigned int layer) const { return _data[layer]; }
+  Real & plasticStrain(unsigned int layer) { return _data[_nlayers + layer]; }
+  Real plasticStrain(unsigned int layer) const { return _data[_nlayers + layer]; }
+  Real & hardening(unsigned int layer) { return _data[2 * _nlayers + layer]; }
+  Real hardening(unsigned int layer) const { return _data[2 * _nlayers + layer]; }
+
+  /// Indexed accessor used for output, only valid for expanded states
+  Real value(Quantity q, unsigned int layer) const { return _data[q * _nlayers + layer]; }
+
+  /// Raw storage for restart
+  std::vector<Real> & data() { return _data; }
+  const std::vector<Real> & data() const { return _data; }
+
+protected:
+  /// Number of layers
+  unsigned int _nlayers;
+
+  /// Packed layer values, see the class description for the layout; empty for compact states
+  std::vector<Real> _data;
+
+  /// Bending stress per unit fiber distance, only used by compact states
+  Real _stress_gradient;
+};
+
+template <>
+void dataStore(std::ostream & stream, LayeredBeamState & state, void * context);
+template <>
+void dataLoad(std::istream & stream, LayeredBeamState & state, void * context);
@@ -0,0 +1,241 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "HardeningCurve.h"
+#include "LayeredBeamState.h"
+
+/**
+ * Layer by layer return mapping of a layered beam section under a curvature increment, with
+ * isotropic hardening that is either linear or tabulated. The fibers are set once per section;
+ * integrate() then advances the layer state of one qp. This does not depend on the material
+ * system, so one increment can be driven on its own.
+ */
+class LayeredSectionReturnMapping
+{
+public:
+  /**
+   * @param yield_stress stress at which plastic strain starts accumulating
+   * @param hardening_constant linear hardening slope, unused once a hardening curve is built
+   * @param max_substeps maximum number of substeps of one curvature increment
+   * @param substep_tolerance relative moment error above which a substep is halved
+   */
+  LayeredSectionReturnMapping(Real yield_stress,
+                              Real hardening_constant,
+                              Real absolute_tolerance,
+                              Real relative_tolerance,
+                              unsigned int max_iterations,
+                              unsigned int max_substeps,
+                              Real substep_tolerance);
+
+  /**
+   * Sets the integration fibers of the section
+   * @param z fiber distances from the section centroid
+   * @param area fiber areas, including the quadrature weights
+   */
+  void setFibers(const std::vector<Real> & z, const std::vector<Real> & area);
+
+  /// Hardening curve of the tabulated law; the law is linear as long as the curve is empty
+  HardeningCurve & hardeningCurve() { return _hardening_curve; }
+
+  /// Number of layers of the section
+  unsigned int layers() const { return _nlayers; }
+
+  /// Distance of each integration fiber from the section centroid, in layer order
+  const std::vector<Real> & layerZ() const { return _layer_z; }
+
+  /// Sum over fibers of z^2 * fiber area
+  Real elasticFlexuralWeight() const { return _elastic_flexural_weight; }
+
+  /// Section moment at which the outermost fiber first yields
+  Real firstYieldMoment() const
+  {
+    return _yield_stress * _elastic_flexural_weight / _max_fiber_distance;
+  }
+
+  /// Stores the layer values of a compact state
+  void expand(LayeredBeamState & state) const { state.expand(_layer_z); }
+
+  /**
+   * Integrates a curvature increment from the converged layer state state_old into state, in
+   * adaptive substeps. Returns false if the increment does not converge within max_substeps
+   * substeps. A compact state_old stays compact as long as the section remains elastic and is
+   * expanded into state when it first yields.
+   */
+  bool integrate(const LayeredBeamState & state_old,
+                 LayeredBeamState & state,
+                 Real youngs_modulus,
+                 Real curvature_increment);
+
+  /// Moment of the layer stresses about the neutral axis
+  Real sectionMoment(const LayeredBeamState & state) const;
+
+  /**
+   * Algorithmic flexural tangent of the last integrated increment: the derivative of its section
+   * moment with respect to its curvature increment, chained through all of its substeps
+   */
+  Real flexuralTangent() const { return _flexural_tangent; }
+
+  /// Substeps used by the last integrated increment
+  unsigned int substeps() const { return _substeps; }
+
+  /// Layers that yielded in the last substep of the last integrated increment
+  unsigned int yieldedLayers() const { return _n_yielded; }
+
+  /// Newton iterations of the last integrated increment, summed over layers and substeps
+  unsigned int iterations() const { return _iterations; }
+
+protected:
+  /// Elastic update of a compact state; returns false, leaving state untouched, if a layer yields
+  bool integrateCompact(const LayeredBeamState & state_old,
+                        LayeredBeamState & state,
+                        Real youngs_modulus,
+                        Real curvature_increment);
+
+  /// integrate() from an expanded state_old
+  bool integrateExpanded(const LayeredBeamState & state_old,
+                         LayeredBeamState & state,
+                         Real youngs_modulus,
+                         Real curvature_increment);
+
+  /// integrate() for a compile-time layer count, with stack scratch arrays
+  template <unsigned int N>
+  bool integrateFixed(const LayeredBeamState & state_old,
+                      LayeredBeamState & state,
+                      Real youngs_modulus,
+                      Real curvature_increment);
+
+  /**
+   * Elastic update of an expanded state under the full increment
+   * @return false, leaving the layer stresses untouched, if a layer yields
+   */
+  template <unsigned int N>
+  bool elasticIncrement(LayeredBeamState & state,
+                        Real youngs_modulus,
+                        Real curvature_increment,
+                        Real * const trial_stress);
+
+  /**
+   * Substepping driver of integrate()
+   * @tparam N number of layers, or 0 to use the runtime count _nlayers
+   * @param trial_stress, yield_condition, yielded_layers scratch arrays of at least _nlayers
+   * entries
+   */
+  template <unsigned int N>
+  bool integrateIncrement(const LayeredBeamState & state_old,
+                          LayeredBeamState & state,
+                          Real youngs_modulus,
+                          Real curvature_increment,
+                          Real * const trial_stress,
+                          Real * const yield_condition,
+                          unsigned int * const yielded_layers);
+
+  /**
+   * Elastic predictor and return mapping of all layers for one substep, in place on state and
+   * on the derivatives of the layer values with respect to the curvature increment of the step
+   * @param curvature_increment curvature increment of the substep
+   * @param increment_fraction fraction of the curvature increment of the step in the substep
+   * @param n_yielded number of yielded layers, set on return
+   * @return false if the return mapping of a layer did not converge
+   */
+  template <unsigned int N>
+  bool integrateLayers(LayeredBeamState & state,
+                       Real youngs_modulus,
+                       Real curvature_increment,
+                       Real increment_fraction,
+                       Real * const trial_stress,
+                       Real * const yield_condition,
+                       unsigned int * const yielded_layers,
+                       unsigned int & n_yielded);
+
+  /// Moment of the first nlayers layer stresses about the neutral axis
+  Real sectionMoment(const LayeredBeamState & state, unsigned int nlayers) const;
+
+  /**
+   * Newton radial return for a single yielded layer, used with a tabulated hardening function
+   * @param i layer index
+   * @param trial_stress elastic trial stress of the layer
+   * @param hardening hardening variable of the layer, updated on return
+   * @param hardening_slope hardening slope at the converged state, set on return
+   * @param plastic_strain_increment signed plastic strain increment, set on return
+   * @return false if the iteration did not converge
+   */
+  bool returnMapLayer(unsigned int i,
+                      Real youngs_modulus,
+                      Real trial_stress,
+                      Real & hardening,
+                      Real & hardening_slope,
+                      Real & plastic_strain_increment);
+
+  /// Hardening variable of layer j and its slope at plastic multiplier scalar
+  void computeHardening(Real scalar, unsigned int j, Real & hardening, Real & slope) const;
+
+  const Real _yield_stress;
+  const Real _hardening_constant;
+
+  /// Tabulated hardening_function
+  HardeningCurve _hardening_curve;
+
+  /// convergence tolerance
+  const Real _absolute_tolerance;
+  const Real _relative_tolerance;
+
+  /// maximum no. of iterations
+  const unsigned int _max_its;
+
+  /// Maximum number of substeps of the curvature increment
+  const unsigned int _max_substeps;
+
+  /// Relative moment error above which a substep is halved
+  const Real _substep_tolerance;
+
+  /// Number of layers
+  unsigned int _nlayers;
+
+  /// Distance of each integration fiber from the section centroid
+  std::vector<Real> _layer_z;
+
+  /// Contribution of a unit fiber stress to the section moment (fiber area * z)
+  std::vector<Real> _layer_moment_weight;
+
+  /// Sum over fibers of z^2 * fiber area
+  Real _elastic_flexural_weight;
+
+  /// Largest fiber distance from the centroid
+  Real _max_fiber_distance;
+
+  /// Plastic moment of the section, used to normalize the substep error estimate
+  Real _moment_scale;
+
+  /// Layer state at the start of the current substep and of the current substep attempt
+  LayeredBeamState _substep_start;
+  LayeredBeamState _increment_start;
+
+  /**
+   * Derivatives of the layer values with respect to the curvature increment of the step, at the
+   * end of the current substep and at the start of the current substep attempt
+   */
+  LayeredBeamState _state_derivative;
+  LayeredBeamState _increment_start_derivative;
+
+  /// Layer values of a compact old state that yields in the current increment
+  LayeredBeamState _expanded_state_old;
+
+  /// Scratch arrays for the layer loop when the layer count is not one of the fixed ones
+  std::vector<Real> _trial_stress;
+  std::vector<Real> _yield_condition;
+  std::vector<unsigned int> _yielded_layers;
+
+  /// Results of the last integrated increment
+  Real _flexural_tangent;
+  unsigned int _substeps;
+  unsigned int _n_yielded;
+  unsigned int _iterations;
+};
@@ -0,0 +1,80 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+#include "BeamSectionShape.h"
+#include "BeamSectionPoint.h"
+
+class BeamSectionStressSampler;
+
+template <>
+InputParameters validParams<BeamSectionStressSampler>();
+
+/**
+ * Samples beam fiber stresses at many points along the beam and many fibers of the section in one
+ * pass. The containing element, shape function values and DOF indices of every point are found
+ * once in initialSetup() and reused until the mesh changes, so execute() does no point location.
+ */
+class BeamSectionStressSampler : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  BeamSectionStressSampler(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// Locates the sampling points and caches their interpolation data
+  void setupPoints();
+
+  /// Interpolation data for a sampling point owned by this processor
+  struct SamplePoint
+  {
+    /// Index of the point in the 'points' parameter
+    unsigned int index;
+
+    /// Cached interpolation data of the section forces and moments
+    BeamSectionPoint value;
+  };
+
+  /// The system holding the section force and moment variables
+  System & _system;
+
+  /// Variable numbers of the section forces and moments
+  std::vector<unsigned int> _var_num;
+
+  /// Points along the beam axis
+  const std::vector<Point> & _points;
+
+  /// Section shape used to recover the fiber stresses
+  std::unique_ptr<BeamSectionShape> _section;
+
+  /// Local (y, z) coordinates of the sampled fibers
+  std::vector<Real> _fiber_y;
+  std::vector<Real> _fiber_z;
+
+  /// Requested stress components (11, 12 and/or 13)
+  std::vector<unsigned int> _components;
+
+  /// Sampling points whose element is owned by this processor
+  std::vector<SamplePoint> _local_points;
+
+  /// Output vectors: point and fiber index of each row and one stress vector per component
+  VectorPostprocessorValue & _point_id;
+  VectorPostprocessorValue & _fiber_id;
+  std::vector<VectorPostprocessorValue *> _stress;
+};
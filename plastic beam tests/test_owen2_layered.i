@@ -65,7 +65,8 @@
     Iz = 26680000
     Iy = 68480000
     area = 9600
-    num_layers = 6
+    num_layers = 3
+    section_quadrature = gauss_lobatto
     depth = 200
     width = '200 10 10 10 10 200'
     thickness = '20 40 40 40 40 20'
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+Reads the chunked binary layer history written by the LayerHistoryWriter user object.
+
+    read_layer_history.py file.bin
+        prints the layout and the time steps in the file
+    read_layer_history.py file.bin --elem 12 --qp 0 --quantity stress --layer 3
+        prints the time series of one layer value as csv
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+QUANTITIES = {0: "stress", 1: "plastic_strain", 2: "hardening_variable"}
+
+
+class LayerHistory:
+    """Layout of a layer history file and an iterator over its chunks."""
+
+    def __init__(self, file_name):
+        self.file = open(file_name, "rb")
+        if self.file.read(8) != b"OTLHIST1":
+            raise ValueError(f"'{file_name}' is not a layer history file")
+        self.n_layers, self.n_qps, n_quantities = self._read("<3I")
+        self.quantities = [QUANTITIES[q] for q in self._read(f"<{n_quantities}I")]
+        value_bytes, self.compression_level = self._read("<2I")
+        self.value_format = "f" if value_bytes == 4 else "d"
+
+    def _read(self, fmt):
+        data = self.file.read(struct.calcsize(fmt))
+        if len(data) < struct.calcsize(fmt):
+            return None
+        return struct.unpack(fmt, data)
+
+    def chunks(self):
+        """Yields (time, time_step, elem_ids, values), see value() for the layout of values."""
+        while True:
+            header = self._read("<dq3Q")
+            if header is None:
+                return
+            time, time_step, n_elems, stored_bytes, raw_bytes = header
+            payload = self.file.read(stored_bytes)
+            if self.compression_level:
+                payload = zlib.decompress(payload)
+            if len(payload) != raw_bytes:
+                raise ValueError(f"truncated chunk at time step {time_step}")
+            ids = struct.unpack_from(f"<{n_elems}Q", payload)
+            n_values = n_elems * self.n_qps * len(self.quantities) * self.n_layers
+            values = struct.unpack_from(f"<{n_values}{self.value_format}", payload, 8 * n_elems)
+            yield time, time_step, ids, values
+
+    def value(self, values, elem, qp, quantity, layer):
+        """Value of the elem-th element of a chunk, ordered by elem, qp, quantity and layer."""
+        return values[((elem * self.n_qps + qp) * len(self.quantities) + quantity) * self.n_layers +
+                      layer]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="layer history file")
+    parser.add_argument("--elem", type=int, help="element id of the time series")
+    parser.add_argument("--qp", type=int, default=0, help="qp of the time series")
+    parser.add_argument("--quantity", default="stress", choices=QUANTITIES.values(),
+                        help="quantity of the time series")
+    parser.add_argument("--layer", type=int, default=0, help="layer of the time series")
+    args = parser.parse_args()
+
+    history = LayerHistory(args.file)
+    if args.elem is None:
+        print(f"layers {history.n_layers}, qps {history.n_qps}, "
+              f"quantities {' '.join(history.quantities)}, "
+              f"float{32 if history.value_format == 'f' else 64}, "
+              f"compression level {history.compression_level}")
+        for time, time_step, ids, _ in history.chunks():
+            print(f"time step {time_step}: time {time:g}, {len(ids)} elements")
+        return
+
+    if args.quantity not in history.quantities:
+        sys.exit(f"the file does not hold {args.quantity}")
+    quantity = history.quantities.index(args.quantity)
+    print(f"time,{args.quantity}")
+    for time, _, ids, values in history.chunks():
+        if args.elem in ids:
+            value = history.value(values, ids.index(args.elem), args.qp, quantity, args.layer)
+            print(f"{time:.12g},{value:.12g}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,210 @@
+# Layered beam bent into the plastic range by opposite end rotations and partially unloaded. The
+# moment is uniform, so every qp follows the same layer history, which LayeredBeamStateAux
+# outputs for the outermost layers.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 10
+    xmin = 0
+    xmax = 3000
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [bottom_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [top_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [top_plastic_strain]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [top_hardening]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [bottom_stress]
+    type = LayeredBeamStateAux
+    variable = bottom_stress
+    quantity = stress
+    layer = 0
+  []
+  [top_stress]
+    type = LayeredBeamStateAux
+    variable = top_stress
+    quantity = stress
+    layer = 7
+  []
+  [top_plastic_strain]
+    type = LayeredBeamStateAux
+    variable = top_plastic_strain
+    quantity = plastic_strain
+    layer = 7
+  []
+  [top_hardening]
+    type = LayeredBeamStateAux
+    variable = top_hardening
+    quantity = hardening_variable
+    layer = 7
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = LayeredBeam
+    num_layers = 8
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_stress = 0.25
+    hardening_constant = 20
+  []
+  [stress]
+    type = ComputeBeamResultantsl
+  []
+[]
+
+[Functions]
+  [left_rotation]
+    type = PiecewiseLinear
+    x = '0 1 2'
+    y = '0 -0.03 -0.002'
+  []
+  [right_rotation]
+    type = PiecewiseLinear
+    x = '0 1 2'
+    y = '0 0.03 0.002'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [left_rot_z]
+    type = FunctionDirichletBC
+    variable = rot_z
+    boundary = left
+    function = left_rotation
+  []
+  [right_rot_z]
+    type = FunctionDirichletBC
+    variable = rot_z
+    boundary = right
+    function = right_rotation
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.1
+  end_time = 2
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  [bottom_stress]
+    type = ElementAverageValue
+    variable = bottom_stress
+  []
+  [top_stress]
+    type = ElementAverageValue
+    variable = top_stress
+  []
+  [top_plastic_strain]
+    type = ElementAverageValue
+    variable = top_plastic_strain
+  []
+  [top_hardening]
+    type = ElementAverageValue
+    variable = top_hardening
+  []
+  [moment]
+    type = ElementIntegralMaterialProperty
+    mat_prop = stress_resultant
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,194 @@
+# Elastic benchmark: ComputeIncrementalBeamStrainl with elastic resultants.
+# Every benchmark case sways the same tower of 3 x 3 bays and 25 storeys, 1000 members in all,
+# clamped at its base, back and forth at its top floor. Columns and beams take their local y
+# direction from the mesh; the plastic cases yield at the base of the ground floor columns.
+# The element count is set from the command line through the number of elements per member,
+# e.g. Mesh/beam/elements_per_member=1000 for one million elements. Newton runs without a line
+# search so that the iteration counts stored in baselines.json do not depend on the PETSc
+# defaults.
+
+[Mesh]
+  [beam]
+    type = BeamFrameMeshGenerator
+    nx = 3
+    ny = 3
+    nz = 25
+    dx = 6000
+    dy = 6000
+    dz = 3500
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Functions]
+  [drift]
+    type = PiecewiseLinear
+    x = '0 1   2 3    4'
+    y = '0 1000 0 -1000 0'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation_integers = 'y_orientation_x y_orientation_y y_orientation_z'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = supports
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = supports
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = supports
+    value = 0
+  []
+  [sway]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = top
+    function = 'drift'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.25
+  end_time = 4
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-10
+[]
+
+[Postprocessors]
+  [residual_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = TOTAL
+  []
+  [jacobian_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeJacobianInternal'
+    data_type = TOTAL
+  []
+  [residual_calls]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = CALLS
+  []
+  [material_time]
+    type = PerfGraphData
+    section_name = 'ComputeIncrementalBeamStrainl::computeProperties'
+    data_type = TOTAL
+  []
+  [kernel_time]
+    type = PerfGraphData
+    section_name = 'StressDivergenceBeamFused::computeResidual'
+    data_type = TOTAL
+  []
+  [nl_its]
+    type = NumNonlinearIterations
+  []
+  [total_nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its
+  []
+  [l_its]
+    type = NumLinearIterations
+  []
+  [total_l_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = l_its
+  []
+  [peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    report_peak_value = true
+  []
+  [rot_y]
+    type = NodalMaxValue
+    boundary = top
+    variable = rot_y
+  []
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
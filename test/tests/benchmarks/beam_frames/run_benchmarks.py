@@ -0,0 +1,153 @@
+#!/usr/bin/env python
+#* This file is part of the MOOSE framework
+#* https://www.mooseframework.org
+#*
+#* All rights reserved, see COPYRIGHT for full restrictions
+#* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+#*
+#* Licensed under LGPL 2.1, please see LICENSE for details
+#* https://www.gnu.org/licenses/lgpl-2.1.html
+
+"""
+Runs the beam benchmark cases at increasing element counts and compares the PerfGraph timings
+(including the timed sections of the beam material and kernel), nonlinear and linear iteration
+counts and peak memory against the values stored in baselines.json. A metric that exceeds its
+baseline by more than the tolerance listed in that file is reported as a regression and the
+script exits with a non-zero status.
+
+All baselines are output of this app. The timings and peak memory are machine specific, and the
+nonlinear and linear iteration counts still move with the PETSc version, the line search and the
+variable scaling, so every metric is compared with a nonzero tolerance. Record the baselines on
+the machine that runs the comparison with
+
+    ./run_benchmarks.py --update
+
+and check the updated baselines.json in together with the change that moved the numbers.
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# Every case runs on the same tower of 1000 members, each split into size / 1000 elements
+FRAME_SIZE = 'Mesh/beam/elements_per_member={}'
+FRAME_MEMBERS = 1000
+
+# case name -> (input file, extra command line arguments)
+CASES = {
+    'elastic': ('elastic.i', []),
+    'plastic_beam': ('plastic_beam.i', []),
+    'layered_beam_8': ('layered_beam.i', ['Materials/strain/num_layers=8']),
+    'layered_beam_32': ('layered_beam.i', ['Materials/strain/num_layers=32']),
+    'nonlinear_beam': ('nonlinear_beam.i', []),
+}
+
+SIZES = [1000, 10000, 100000, 1000000]
+
+# Postprocessors read from the last row of each case's csv output
+METRICS = ['residual_time', 'jacobian_time', 'material_time', 'kernel_time', 'total_nl_its',
+           'total_l_its', 'peak_memory']
+
+def findExecutable():
+    root = os.path.abspath(os.path.join(HERE, '..', '..', '..', '..'))
+    for method in [os.environ.get('METHOD', 'opt'), 'opt', 'oprof', 'devel', 'dbg']:
+        exe = os.path.join(root, 'otter-' + method)
+        if os.path.exists(exe):
+            return exe
+    return None
+
+def runCase(exe, case, size, mpi_procs, threads):
+    input_file, args = CASES[case]
+    file_base = '{}_{}'.format(case, size)
+    elements_per_member = max(size // FRAME_MEMBERS, 1)
+    command = [exe, '-i', input_file, FRAME_SIZE.format(elements_per_member),
+               'Outputs/file_base=' + file_base] + args
+    if threads > 1:
+        command.append('--n-threads={}'.format(threads))
+    if mpi_procs > 1:
+        command = ['mpiexec', '-n', str(mpi_procs)] + command
+
+    print('Running {} with {} elements'.format(case, size))
+    with open(os.path.join(HERE, file_base + '.log'), 'w') as log:
+        result = subprocess.call(command, cwd=HERE, stdout=log, stderr=subprocess.STDOUT)
+    if result != 0:
+        print('  failed, see {}.log'.format(file_base))
+        return None
+
+    with open(os.path.join(HERE, file_base + '.csv')) as f:
+        rows = list(csv.DictReader(f))
+    return {name: float(rows[-1][name]) for name in METRICS}
+
+def compare(key, values, baseline, tolerances):
+    regressions = []
+    for name in METRICS:
+        if name not in baseline:
+            continue
+        tolerance = tolerances.get(name, tolerances.get('default', 0.1))
+        limit = baseline[name] * (1.0 + tolerance)
+        status = 'ok'
+        if values[name] > limit:
+            status = 'REGRESSION'
+            regressions.append('{} {}'.format(key, name))
+        print('  {:<14} {:>14.6g} baseline {:>14.6g} ({:+.1%}) {}'.format(
+            name, values[name], baseline[name],
+            values[name] / baseline[name] - 1.0 if baseline[name] else 0.0, status))
+    return regressions
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable',
+                        help='otter executable, found next to the Makefile by default')
+    parser.add_argument('--cases', nargs='+', choices=sorted(CASES.keys()),
+                        default=sorted(CASES.keys()))
+    parser.add_argument('--sizes', nargs='+', type=int, default=SIZES)
+    parser.add_argument('-p', '--mpi-procs', type=int, default=1)
+    parser.add_argument('--n-threads', type=int, default=1)
+    parser.add_argument('--baselines', default=os.path.join(HERE, 'baselines.json'))
+    parser.add_argument('--update', action='store_true',
+                        help='store the measured values as the new baselines')
+    opts = parser.parse_args()
+
+    exe = opts.executable or findExecutable()
+    if not exe:
+        sys.exit('Could not find the otter executable, pass it with --executable')
+
+    with open(opts.baselines) as f:
+        stored = json.load(f)
+    tolerances = stored.get('tolerances', {})
+    baselines = stored.setdefault('baselines', {})
+
+    regressions = []
+    failed = []
+    for case in opts.cases:
+        for size in opts.sizes:
+            key = '{}/{}'.format(case, size)
+            values = runCase(os.path.abspath(exe), case, size, opts.mpi_procs, opts.n_threads)
+            if values is None:
+                failed.append(key)
+            elif opts.update:
+                baselines[key] = values
+            elif key in baselines:
+                regressions += compare(key, values, baselines[key], tolerances)
+            else:
+                print('  no baseline stored for {}, record it with --update'.format(key))
+
+    if opts.update:
+        with open(opts.baselines, 'w') as f:
+            json.dump(stored, f, indent=2, sort_keys=True)
+            f.write('\n')
+
+    for key in failed:
+        print('FAILED: ' + key)
+    for regression in regressions:
+        print('REGRESSION: ' + regression)
+    return 1 if failed or regressions else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,238 @@
+# Elastic cantilever under four independent tip load cases, given as functions of time that are
+# evaluated at t = k for load case k. The batched solve, which factors the Jacobian once, has to
+# reproduce a transient run that assembles and factors it in every time step; a small strain
+# elastic beam does not depend on its load history, so both give the same results.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 40
+    xmin = 0
+    xmax = 4000
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [forces_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [forces_x]
+    type = MaterialRealVectorValueAux
+    variable = forces_x
+    property = forces
+    component = 0
+  []
+  [forces_y]
+    type = MaterialRealVectorValueAux
+    variable = forces_y
+    property = forces
+    component = 1
+  []
+  [forces_z]
+    type = MaterialRealVectorValueAux
+    variable = forces_z
+    property = forces
+    component = 2
+  []
+  [moments_x]
+    type = MaterialRealVectorValueAux
+    variable = moments_x
+    property = moments
+    component = 0
+  []
+  [moments_y]
+    type = MaterialRealVectorValueAux
+    variable = moments_y
+    property = moments
+    component = 1
+  []
+  [moments_z]
+    type = MaterialRealVectorValueAux
+    variable = moments_z
+    property = moments
+    component = 2
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 1.152e7
+    Iy = 5.12e6
+    area = 9600
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+  [tip_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = right
+    function = 'if(t < 1.5, 10, if(t < 2.5, 0, if(t < 3.5, -6, 5)))'
+  []
+  [tip_z]
+    type = FunctionDirichletBC
+    variable = disp_z
+    boundary = right
+    function = 'if(t < 1.5, 0, if(t < 2.5, 4, if(t < 3.5, 3, -2)))'
+  []
+  [tip_twist]
+    type = FunctionDirichletBC
+    variable = rot_x
+    boundary = right
+    function = 'if(t < 2.5, 0, if(t < 3.5, 1e-3, -2e-3))'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = BeamLoadCaseSteady
+  num_load_cases = 4
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-10
+[]
+
+[Postprocessors]
+  [tip_disp_x]
+    type = PointValue
+    point = '4000 0 0'
+    variable = disp_x
+  []
+  [mid_disp_y]
+    type = PointValue
+    point = '2000 0 0'
+    variable = disp_y
+  []
+  [mid_disp_z]
+    type = PointValue
+    point = '2000 0 0'
+    variable = disp_z
+  []
+  [tip_rot_y]
+    type = PointValue
+    point = '4000 0 0'
+    variable = rot_y
+  []
+  [tip_rot_z]
+    type = PointValue
+    point = '4000 0 0'
+    variable = rot_z
+  []
+  [root_stress]
+    type = RectangularBeamStress
+    stress_component = 11
+    point = '0 0 0'
+    depth = 120
+    width = 80
+    y_location = 1
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
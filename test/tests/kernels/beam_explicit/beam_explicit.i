@@ -0,0 +1,198 @@
+# Cantilever suddenly loaded at its tip, integrated with explicit central difference. The lumped
+# beam inertia gives a diagonal mass matrix and BeamCriticalTimeStep sets the stable time step
+# through PostprocessorDT. Evaluating BeamCriticalTimeStep at the end of each step also stores the
+# beam resultants of the new solution, from which the next explicit step starts.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 10
+    xmin = 0
+    xmax = 4000
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210000
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 2.7e7
+    Iy = 1.2e7
+    area = 9600
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+  [density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 7.85e-9
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+[]
+
+[NodalKernels]
+  [tip_load]
+    type = ConstantRate
+    variable = disp_y
+    boundary = right
+    rate = 1000
+  []
+[]
+
+[Kernels]
+  [inertia_disp_x]
+    type = InertialForceBeamLumped
+    variable = disp_x
+    component = 0
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [inertia_disp_y]
+    type = InertialForceBeamLumped
+    variable = disp_y
+    component = 1
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [inertia_disp_z]
+    type = InertialForceBeamLumped
+    variable = disp_z
+    component = 2
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [inertia_rot_x]
+    type = InertialForceBeamLumped
+    variable = rot_x
+    component = 3
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [inertia_rot_y]
+    type = InertialForceBeamLumped
+    variable = rot_y
+    component = 4
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [inertia_rot_z]
+    type = InertialForceBeamLumped
+    variable = rot_z
+    component = 5
+    area = 9600
+    Iy = 1.2e7
+    Iz = 2.7e7
+  []
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    compute_jacobian = false
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 50
+  [TimeIntegrator]
+    type = CentralDifference
+    solve_type = lumped
+  []
+  [TimeStepper]
+    type = PostprocessorDT
+    postprocessor = critical_dt
+  []
+[]
+
+[Postprocessors]
+  [critical_dt]
+    type = BeamCriticalTimeStep
+    factor = 0.5
+    execute_on = 'initial timestep_end'
+  []
+  [dt]
+    type = TimestepSize
+  []
+  [tip_disp_y]
+    type = PointValue
+    point = '4000 0 0'
+    variable = disp_y
+  []
+  [tip_rot_z]
+    type = PointValue
+    point = '4000 0 0'
+    variable = rot_z
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,166 @@
+# Elastic-plastic layered beam loaded at mid-span, with plasticity localized around the load.
+# The hybrid section, which integrates the elements away from the load with the resultant law,
+# has to reproduce the results of the fully layered section. layered_length records how much of
+# the beam has switched to layered integration.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 64
+    xmin = 0
+    xmax = 3000
+  []
+  [mid]
+    type = ExtraNodesetGenerator
+    new_boundary = mid
+    coord = '1500 0 0'
+    input = beam
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = HybridLayeredBeam
+    num_layers = 8
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_stress = 0.25
+    hardening_constant = 2
+  []
+  [stress]
+    type = ComputeBeamResultantsl
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = mid
+    function = '5*t'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 3
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  [disp_y]
+    type = PointValue
+    point = '750 0 0'
+    variable = disp_y
+  []
+  [rot_z]
+    type = NodalMaxValue
+    boundary = right
+    variable = rot_z
+  []
+  [moment]
+    type = ElementIntegralMaterialProperty
+    mat_prop = stress_resultant
+  []
+  # length of the elements integrated layer by layer; the others use the resultant law
+  [layered_length]
+    type = ElementIntegralMaterialProperty
+    mat_prop = layered_integration
+  []
+  # solver health counters must not depend on how the elements are split between threads
+  [yielded_layers]
+    type = BeamSolverHealth
+    quantity = yielded_layers
+  []
+  [yielded_qps]
+    type = BeamSolverHealth
+    quantity = yielded_qps
+  []
+  [total_iterations]
+    type = BeamSolverHealth
+    quantity = total_iterations
+  []
+  [max_substeps]
+    type = BeamSolverHealth
+    quantity = max_substeps
+  []
+  [failed_return_mappings]
+    type = BeamSolverHealth
+    quantity = failed_return_mappings
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
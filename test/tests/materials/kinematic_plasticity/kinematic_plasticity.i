@@ -0,0 +1,135 @@
+# Bar of solid elements bent into the plastic range and back with linear kinematic hardening.
+# The closed form radial return with its consistent tangent, the Newton return of the same law
+# given as a linear hardening_function, and the solve with the elastic tangent, which converges
+# far more slowly, have to reach the same solution. nl_its records the quadratic convergence of
+# the consistent tangent, so the line search is disabled. The tip displacement is not preset: a preset
+# jump of the tip node yields the end elements in the first iterate, from which the undamped
+# Newton iteration does not recover.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [bar]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 10
+    ny = 2
+    nz = 2
+    xmax = 1000
+    ymax = 100
+    zmax = 50
+  []
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    add_variables = true
+    incremental = true
+    volumetric_locking_correction = false
+    generate_output = 'stress_xx vonmises_stress effective_plastic_strain'
+  []
+[]
+
+[Materials]
+  inactive = tabulated_plasticity
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 210
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = kinematic_plasticity
+  []
+  [kinematic_plasticity]
+    type = KinematicPlasticityStressUpdate
+    yield_stress = 0.25
+    hardening_constant = 20
+  []
+  [tabulated_plasticity]
+    type = KinematicPlasticityStressUpdate
+    yield_stress = 0.25
+    hardening_function = hardening
+  []
+]
+
+[Functions]
+  # the same linear hardening as hardening_constant
+  [hardening]
+    type = PiecewiseLinear
+    x = '0 1'
+    y = '0.25 20.25'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [tip]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = right
+    function = '20 * sin(pi * t / 2)'
+    preset = false
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  line_search = none
+  dt = 0.25
+  end_time = 3
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-12
+  nl_max_its = 100
+[]
+
+[Postprocessors]
+  [nl_its]
+    type = NumNonlinearIterations
+  []
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  []
+  [vonmises_stress]
+    type = ElementExtremeValue
+    variable = vonmises_stress
+  []
+  [effective_plastic_strain]
+    type = ElementExtremeValue
+    variable = effective_plastic_strain
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
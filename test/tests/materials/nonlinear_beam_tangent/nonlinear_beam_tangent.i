@@ -0,0 +1,262 @@
+# Cantilever inclined at 45 degrees in the xy plane with a skewed local y direction, loaded at its
+# tip by global forces that combine tension with bending about both local axes, into the plastic
+# range of NonlinearBeam. The Jacobian is assembled from the full consistent tangent of the return
+# in the beam local coordinate system, so Newton converges quadratically without a line search:
+# the nonlinear iteration counts are part of the gold file. The same solve with the elastic
+# tangent does not converge within the default 50 iterations once the base element yields.
+# The fused kernel assembles the same consistent tangent for all six variables at once.
+
+[Mesh]
+  [line]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmin = 0
+    xmax = 1200
+  []
+  [incline]
+    type = TransformGenerator
+    input = line
+    transform = ROTATE
+    vector_value = '45 0 0'
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Functions]
+  # tip force of 10000, 15000 and 12000 along the beam, 40, 50 and 55 along the local y axis and
+  # 20, -20 and -25 along the local z axis at t = 1, 2 and 3
+  [force_x]
+    type = PiecewiseLinear
+    x = '0 1 2 3'
+    y = '0 7056.1387669072 10569.569238529 8443.3209021715'
+  []
+  [force_y]
+    type = PiecewiseLinear
+    x = '0 1 2 3'
+    y = '0 7085.9968568238 10643.634197067 8527.2418463056'
+  []
+  [force_z]
+    type = PiecewiseLinear
+    x = '0 1 2 3'
+    y = '0 39.42394238614 12.537581840927 11.341850282236'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210000
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 1000
+    Iy = 1000
+    area = 100
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '-1 1 1'
+  []
+  [stress]
+    type = NonlinearBeam
+    yield_force = '25000 25000 25000'
+    yield_moments = '50000 60000 60000'
+    isotropic_hardening_coefficient = 0.1
+    kinematic_hardening_coefficient = 0.05
+    hardening_constant = 0.5
+    absolute_tolerance = 1e-12
+    relative_tolerance = 1e-12
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+[]
+
+[NodalKernels]
+  [tip_force_x]
+    type = UserForcingFunctionNodalKernel
+    variable = disp_x
+    boundary = right
+    function = force_x
+  []
+  [tip_force_y]
+    type = UserForcingFunctionNodalKernel
+    variable = disp_y
+    boundary = right
+    function = force_y
+  []
+  [tip_force_z]
+    type = UserForcingFunctionNodalKernel
+    variable = disp_z
+    boundary = right
+    function = force_z
+  []
+[]
+
+[Kernels]
+  inactive = fused
+  [fused]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    use_elastoplastic_tangent = true
+  []
+  [solid_disp_x]
+    type = StressDivergenceBeaml
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 0
+    use_elastoplastic_tangent = true
+  []
+  [solid_disp_y]
+    type = StressDivergenceBeaml
+    variable = disp_y
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 1
+    use_elastoplastic_tangent = true
+  []
+  [solid_disp_z]
+    type = StressDivergenceBeaml
+    variable = disp_z
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 2
+    use_elastoplastic_tangent = true
+  []
+  [solid_rot_x]
+    type = StressDivergenceBeaml
+    variable = rot_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 3
+    use_elastoplastic_tangent = true
+  []
+  [solid_rot_y]
+    type = StressDivergenceBeaml
+    variable = rot_y
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 4
+    use_elastoplastic_tangent = true
+  []
+  [solid_rot_z]
+    type = StressDivergenceBeaml
+    variable = rot_z
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    component = 5
+    use_elastoplastic_tangent = true
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  line_search = none
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-8
+  dt = 0.25
+  end_time = 3
+[]
+
+[Postprocessors]
+  [nl_its]
+    type = NumNonlinearIterations
+  []
+  [tip_disp_x]
+    type = NodalVariableValue
+    variable = disp_x
+    nodeid = 4
+  []
+  [tip_disp_y]
+    type = NodalVariableValue
+    variable = disp_y
+    nodeid = 4
+  []
+  [tip_disp_z]
+    type = NodalVariableValue
+    variable = disp_z
+    nodeid = 4
+  []
+  [tip_rot_x]
+    type = NodalVariableValue
+    variable = rot_x
+    nodeid = 4
+  []
+  [tip_rot_y]
+    type = NodalVariableValue
+    variable = rot_y
+    nodeid = 4
+  []
+  [tip_rot_z]
+    type = NodalVariableValue
+    variable = rot_z
+    nodeid = 4
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
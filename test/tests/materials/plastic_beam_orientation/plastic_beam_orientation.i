@@ -0,0 +1,173 @@
+# PlasticBeam cantilever bent past its yield moment and partly unloaded, so that every return
+# mapping starts from the local moment of the previous step. The reference run lies along x and
+# bends about the global z axis. The test turns the same cantilever onto the y axis with its local
+# y direction along z, so that it bends about the global x axis, and compares its results against
+# the reference.
+
+[Mesh]
+  [line]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 10
+    xmin = 0
+    xmax = 4000
+  []
+  [beam]
+    type = TransformGenerator
+    input = line
+    transform = ROTATE
+    vector_value = '0 0 0'
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [local_moment_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  # moments are stored in the global frame, the component along the local z axis of the member
+  # is set per run
+  [local_moment_z]
+    type = MaterialRealVectorValueAux
+    variable = local_moment_z
+    property = moments
+    component = 2
+  []
+[]
+
+[Functions]
+  [tip]
+    type = PiecewiseLinear
+    x = '0 2  4'
+    y = '0 4 2'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = PlasticBeam
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_moment = 25000
+    hardening_constant = 1.771875e9
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+  # tip displacement along the local y direction
+  [tip]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = right
+    function = tip
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 4
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-10
+[]
+
+[Postprocessors]
+  # the sign of the global moment component depends on the direction the member runs in
+  [moment_norm]
+    type = ElementL2Norm
+    variable = local_moment_z
+  []
+  [plastic_stretch]
+    type = ElementIntegralMaterialProperty
+    mat_prop = plastic_stretch
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,199 @@
+# Braced frame of 1 x 1 bays and two storeys, clamped at its base and pushed sideways along its
+# x bay lines at its top floor. The columns, beams and braces each take their local y direction
+# from the mesh. The reported extremes of the local resultants do not change when the plan is
+# rotated and the drift turned with it.
+
+[Mesh]
+  [frame]
+    type = BeamFrameMeshGenerator
+    nx = 1
+    ny = 1
+    nz = 2
+    dx = 6000
+    dy = 6000
+    dz = 3500
+    elements_per_member = 2
+    braced = true
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [forces_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [forces_x]
+    type = MaterialRealVectorValueAux
+    variable = forces_x
+    property = forces
+    component = 0
+  []
+  [moments_z]
+    type = MaterialRealVectorValueAux
+    variable = moments_z
+    property = moments
+    component = 2
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation_integers = 'y_orientation_x y_orientation_y y_orientation_z'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = supports
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = supports
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = supports
+    value = 0
+  []
+  [drift_x]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = top
+    function = '20*t'
+  []
+  [drift_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = top
+    function = '0'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 1
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  [column_force_max]
+    type = ElementExtremeValue
+    variable = forces_x
+    value_type = max
+    block = columns
+  []
+  [column_force_min]
+    type = ElementExtremeValue
+    variable = forces_x
+    value_type = min
+    block = columns
+  []
+  [column_moment_max]
+    type = ElementExtremeValue
+    variable = moments_z
+    value_type = max
+    block = columns
+  []
+  [column_moment_min]
+    type = ElementExtremeValue
+    variable = moments_z
+    value_type = min
+    block = columns
+  []
+  [brace_force_max]
+    type = ElementExtremeValue
+    variable = forces_x
+    value_type = max
+    block = braces
+  []
+  [brace_force_min]
+    type = ElementExtremeValue
+    variable = forces_x
+    value_type = min
+    block = braces
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,186 @@
+# Plane grid of 2 x 2 bays clamped along its edges and pushed down at its centre joint. All the
+# members of a grid have their local y direction along z, so the orientation read from the mesh
+# has to reproduce the results of the inactive strain_uniform material, which sets the z axis on
+# every element.
+
+[Mesh]
+  [frame]
+    type = BeamFrameMeshGenerator
+    nx = 2
+    ny = 2
+    nz = 0
+    dx = 3000
+    dy = 3000
+    elements_per_member = 4
+  []
+  [centre]
+    type = ExtraNodesetGenerator
+    new_boundary = centre
+    coord = '3000 3000 0'
+    input = frame
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [moments_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [moments_z]
+    type = MaterialRealVectorValueAux
+    variable = moments_z
+    property = moments
+    component = 2
+  []
+[]
+
+[Materials]
+  inactive = strain_uniform
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation_integers = 'y_orientation_x y_orientation_y y_orientation_z'
+  []
+  [strain_uniform]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 0 1'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = supports
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = supports
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = supports
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = supports
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_z
+    boundary = centre
+    function = '-10*t'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 1
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  [disp_z]
+    type = PointValue
+    point = '1500 3000 0'
+    variable = disp_z
+  []
+  [rot_x]
+    type = PointValue
+    point = '3000 1500 0'
+    variable = rot_x
+  []
+  [rot_y]
+    type = PointValue
+    point = '1500 3000 0'
+    variable = rot_y
+  []
+  [moment_max]
+    type = ElementExtremeValue
+    variable = moments_z
+    value_type = max
+  []
+  [moment_min]
+    type = ElementExtremeValue
+    variable = moments_z
+    value_type = min
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
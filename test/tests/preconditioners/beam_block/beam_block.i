@@ -0,0 +1,176 @@
+# Elastic cantilever bent about both section axes and twisted at its tip. Its Iz/area ratio is
+# large, like the frame models, so the rotation and displacement DOFs have very different
+# stiffness scales. The iterative solves with BeamBlockPreconditioner and a PJFNK solve
+# preconditioned with the nodal diagonal blocks of the beam stiffness have to reproduce the direct
+# LU solve.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 40
+    xmin = 0
+    xmax = 4000
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 2.7e7
+    Iy = 1.2e7
+    area = 9600
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+  [tip_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = right
+    function = '10*t'
+  []
+  [tip_z]
+    type = FunctionDirichletBC
+    variable = disp_z
+    boundary = right
+    function = '4*t'
+  []
+  [tip_twist]
+    type = FunctionDirichletBC
+    variable = rot_x
+    boundary = right
+    function = '1e-3*t'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  active = beam_block
+  [beam_block]
+    type = BeamBlockPreconditioner
+    displacements = 'disp_x disp_y disp_z'
+    rotations = 'rot_x rot_y rot_z'
+  []
+  # direct solve for the reference results
+  [SMP]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 0.5
+  end_time = 1
+  nl_abs_tol = 1e-8
+  nl_rel_tol = 1e-10
+  l_tol = 1e-10
+  # point block Jacobi needs many more linear iterations than the Schur split
+  l_max_its = 2000
+[]
+
+[Postprocessors]
+  [tip_disp_x]
+    type = PointValue
+    point = '4000 0 0'
+    variable = disp_x
+  []
+  [mid_disp_y]
+    type = PointValue
+    point = '2000 0 0'
+    variable = disp_y
+  []
+  [mid_disp_z]
+    type = PointValue
+    point = '2000 0 0'
+    variable = disp_z
+  []
+  [tip_rot_y]
+    type = PointValue
+    point = '4000 0 0'
+    variable = rot_y
+  []
+  [tip_rot_z]
+    type = PointValue
+    point = '4000 0 0'
+    variable = rot_z
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
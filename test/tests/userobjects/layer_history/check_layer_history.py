@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Reads the history of one element of a layer history file with scripts/read_layer_history.py and
+compares it against a gold csv whose columns are time and <quantity>_<layer>, or against the
+history of the same element in a second layer history file.
+
+    check_layer_history.py file.bin gold.csv --elem 8 --qp 1
+    check_layer_history.py file.bin reference.bin --elem 8 --qp 1 --columns stress_0 stress_7
+"""
+
+import argparse
+import csv
+import math
+import os
+import subprocess
+import sys
+
+READER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..", "..",
+                      "scripts", "read_layer_history.py")
+
+
+def read(*args):
+    """Output lines of read_layer_history.py called with args."""
+    result = subprocess.run([sys.executable, READER] + list(args), stdout=subprocess.PIPE,
+                            universal_newlines=True, check=True)
+    return result.stdout.splitlines()
+
+
+def series(file_name, elem, qp, column):
+    """(time, value) pairs of the <quantity>_<layer> column of one element in a layer history."""
+    quantity, layer = column.rsplit("_", 1)
+    rows = read(file_name, "--elem", str(elem), "--qp", str(qp), "--quantity", quantity,
+                "--layer", layer)[1:]
+    return [tuple(float(x) for x in row.split(",")) for row in rows]
+
+
+def reference(args):
+    """Rows of the gold csv, or of the same element of the reference layer history file."""
+    if not args.gold.endswith(".bin"):
+        with open(args.gold) as gold_file:
+            return list(csv.DictReader(gold_file))
+
+    if not args.columns:
+        sys.exit("--columns is required to compare against a layer history file")
+    gold = []
+    for column in args.columns:
+        for step, (time, value) in enumerate(series(args.gold, args.elem, args.qp, column)):
+            if step == len(gold):
+                gold.append({"time": repr(time)})
+            gold[step][column] = repr(value)
+    return gold
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="layer history file")
+    parser.add_argument("gold", help="gold csv or reference layer history file")
+    parser.add_argument("--elem", type=int, required=True, help="element id")
+    parser.add_argument("--qp", type=int, default=0, help="qp")
+    parser.add_argument("--rel-err", type=float, default=1e-5, help="relative tolerance")
+    parser.add_argument("--abs-zero", type=float, default=1e-9, help="absolute tolerance")
+    parser.add_argument("--columns", nargs="+",
+                        help="<quantity>_<layer> columns compared against a layer history file")
+    args = parser.parse_args()
+
+    gold = reference(args)
+    columns = [name for name in gold[0] if name != "time"]
+
+    # the summary lists one line per written time step after the layout
+    steps = read(args.file)[1:]
+    if len(steps) != len(gold):
+        sys.exit(f"{len(steps)} time steps in {args.file}, {len(gold)} in {args.gold}")
+
+    failed = False
+    for column in columns:
+        rows = series(args.file, args.elem, args.qp, column)
+        if len(rows) != len(gold):
+            sys.exit(f"{len(rows)} values of {column} in {args.file}, {len(gold)} in {args.gold}")
+        for (time, value), gold_row in zip(rows, gold):
+            expected = float(gold_row[column])
+            if not math.isclose(time, float(gold_row["time"]), rel_tol=1e-12):
+                sys.exit(f"time {time} in {args.file}, {gold_row['time']} in {args.gold}")
+            if not math.isclose(value, expected, rel_tol=args.rel_err, abs_tol=args.abs_zero):
+                print(f"{column} at time {time}: {value} != {expected}")
+                failed = True
+
+    if failed:
+        sys.exit(1)
+    print(f"{args.file} matches {args.gold}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+# Elastic-plastic layered beam loaded at mid-span, writing the layer history of every second
+# element at every second time step to a compressed binary file. The history of element 8, next
+# to the load, is read back with scripts/read_layer_history.py.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 16
+    xmin = 0
+    xmax = 3000
+  []
+  [mid]
+    type = ExtraNodesetGenerator
+    new_boundary = mid
+    coord = '1500 0 0'
+    input = beam
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210
+  []
+  [strain]
+    type = LayeredBeam
+    num_layers = 8
+    Iz = 84375000
+    Iy = 337500000
+    area = 45000
+    depth = 300
+    width = 150
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+    yield_stress = 0.25
+    hardening_constant = 2
+  []
+  [stress]
+    type = ComputeBeamResultantsl
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right'
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [load]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = mid
+    function = '5*t'
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 0.5
+  end_time = 3
+  nl_abs_tol = 1e-8
+[]
+
+[Postprocessors]
+  [disp_y]
+    type = PointValue
+    point = '750 0 0'
+    variable = disp_y
+  []
+[]
+
+[UserObjects]
+  [layer_history]
+    type = LayerHistoryWriter
+    quantities = 'stress plastic_strain hardening_variable'
+    element_interval = 2
+    time_interval = 2
+    precision = single
+    compression_level = 6
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
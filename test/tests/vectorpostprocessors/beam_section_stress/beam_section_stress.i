@@ -0,0 +1,282 @@
+# Cantilever with axial and transverse tip loads. The section forces and moments are statically
+# determinate, and every sampling point lies at the middle of an element, where the constant
+# section moments of the element are exact. The single point postprocessors are evaluated at the
+# points and fibers of BeamSectionStressSampler. The circular samplers reuse the same section
+# forces to check the circular stress recovery.
+
+[Mesh]
+  [beam]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 4
+    xmin = 0
+    xmax = 4000
+  []
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [rot_x]
+  []
+  [rot_y]
+  []
+  [rot_z]
+  []
+[]
+
+[AuxVariables]
+  [forces_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [forces_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_x]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_y]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [moments_z]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [forces_x]
+    type = MaterialRealVectorValueAux
+    variable = forces_x
+    property = forces
+    component = 0
+  []
+  [forces_y]
+    type = MaterialRealVectorValueAux
+    variable = forces_y
+    property = forces
+    component = 1
+  []
+  [forces_z]
+    type = MaterialRealVectorValueAux
+    variable = forces_z
+    property = forces
+    component = 2
+  []
+  [moments_x]
+    type = MaterialRealVectorValueAux
+    variable = moments_x
+    property = moments
+    component = 0
+  []
+  [moments_y]
+    type = MaterialRealVectorValueAux
+    variable = moments_y
+    property = moments
+    component = 1
+  []
+  [moments_z]
+    type = MaterialRealVectorValueAux
+    variable = moments_z
+    property = moments
+    component = 2
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeElasticityBeam
+    poissons_ratio = 0.3
+    youngs_modulus = 210000
+  []
+  [strain]
+    type = ComputeIncrementalBeamStrainl
+    Iz = 337500000
+    Iy = 84375000
+    area = 45000
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+    y_orientation = '0 1 0'
+  []
+  [stress]
+    type = ComputeBeamResultants
+  []
+[]
+
+[BCs]
+  [fix_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_disp_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = left
+    value = 0
+  []
+  [fix_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = left
+    value = 0
+  []
+  [fix_rot_x]
+    type = DirichletBC
+    variable = rot_x
+    boundary = left
+    value = 0
+  []
+  [fix_rot_y]
+    type = DirichletBC
+    variable = rot_y
+    boundary = left
+    value = 0
+  []
+  [fix_rot_z]
+    type = DirichletBC
+    variable = rot_z
+    boundary = left
+    value = 0
+  []
+[]
+
+[NodalKernels]
+  [axial_load]
+    type = ConstantRate
+    variable = disp_x
+    boundary = right
+    rate = 2000
+  []
+  [load_y]
+    type = ConstantRate
+    variable = disp_y
+    boundary = right
+    rate = 1000
+  []
+  [load_z]
+    type = ConstantRate
+    variable = disp_z
+    boundary = right
+    rate = 500
+  []
+[]
+
+[Kernels]
+  [beam]
+    type = StressDivergenceBeamFused
+    variable = disp_x
+    rotations = 'rot_x rot_y rot_z'
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_abs_tol = 1e-8
+[]
+
+[VectorPostprocessors]
+  [rectangular]
+    type = BeamSectionStressSampler
+    points = '1500 0 0  3500 0 0'
+    section = rectangular
+    depth = 300
+    width = 150
+    y_location = '1 0.5 0'
+    z_location = '0.5 1 0'
+    stress_components = '11 12 13'
+  []
+  [circular]
+    type = BeamSectionStressSampler
+    points = '1500 0 0  3500 0 0'
+    section = circular
+    radius = 100
+    r_location = '1 0.5'
+    theta = '0 90'
+    stress_components = '11 12 13'
+  []
+[]
+
+[Postprocessors]
+  # point 0 and 1 are the sampler points, fibers 0 to 2 its fibers
+  [rectangular_11_p0_f0]
+    type = RectangularBeamStress
+    point = '1500 0 0'
+    depth = 300
+    width = 150
+    y_location = 1
+    z_location = 0.5
+    stress_component = 11
+  []
+  [rectangular_12_p0_f1]
+    type = RectangularBeamStress
+    point = '1500 0 0'
+    depth = 300
+    width = 150
+    y_location = 0.5
+    z_location = 1
+    stress_component = 12
+  []
+  [rectangular_11_p1_f2]
+    type = RectangularBeamStress
+    point = '3500 0 0'
+    depth = 300
+    width = 150
+    y_location = 0
+    z_location = 0
+    stress_component = 11
+  []
+  [rectangular_13_p1_f1]
+    type = RectangularBeamStress
+    point = '3500 0 0'
+    depth = 300
+    width = 150
+    y_location = 0.5
+    z_location = 1
+    stress_component = 13
+  []
+  [circular_11_p0_f1]
+    type = CircularBeamStress
+    point = '1500 0 0'
+    radius = 100
+    r_location = 0.5
+    theta = 90
+    stress_component = 11
+  []
+  [circular_12_p1_f0]
+    type = CircularBeamStress
+    point = '3500 0 0'
+    radius = 100
+    r_location = 1
+    theta = 0
+    stress_component = 12
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
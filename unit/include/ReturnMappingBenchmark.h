@@ -0,0 +1,130 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Helpers for the return mapping microbenchmarks: synthetic strain histories, a timer and the
+ * report line. The number of timed passes over each history is taken from the
+ * OTTER_BENCHMARK_REPEAT environment variable so that the same tests serve as quick unit tests
+ * and as longer benchmark runs.
+ */
+namespace ReturnMappingBenchmark
+{
+/// Synthetic strain histories, scaled by the yield strain of the driven model
+enum class History
+{
+  ELASTIC,
+  MONOTONIC,
+  CYCLIC
+};
+
+inline std::string
+name(History history)
+{
+  switch (history)
+  {
+    case History::ELASTIC:
+      return "elastic";
+    case History::MONOTONIC:
+      return "monotonic";
+    default:
+      return "cyclic";
+  }
+}
+
+/**
+ * Strain increments of a history
+ * @param yield_strain strain at first yield of the driven model
+ * @param steps number of increments
+ */
+inline std::vector<Real>
+increments(History history, Real yield_strain, unsigned int steps)
+{
+  std::vector<Real> total(steps + 1);
+  for (unsigned int k = 0; k <= steps; ++k)
+  {
+    const Real s = Real(k) / steps;
+    switch (history)
+    {
+      case History::ELASTIC: // out to half the yield strain and back
+        total[k] = 0.5 * yield_strain * std::sin(M_PI * s);
+        break;
+      case History::MONOTONIC: // out to ten times the yield strain
+        total[k] = 10.0 * yield_strain * s;
+        break;
+      case History::CYCLIC: // four fully reversed cycles at five times the yield strain
+        total[k] = 5.0 * yield_strain * std::sin(8.0 * M_PI * s);
+        break;
+    }
+  }
+
+  std::vector<Real> increment(steps);
+  for (unsigned int k = 0; k < steps; ++k)
+    increment[k] = total[k + 1] - total[k];
+  return increment;
+}
+
+/// Number of timed passes over each history
+inline unsigned int
+repeats()
+{
+  const char * repeat = std::getenv("OTTER_BENCHMARK_REPEAT");
+  return repeat ? std::max(1, std::atoi(repeat)) : 20;
+}
+
+/// Wall clock timer
+class Timer
+{
+public:
+  Timer() : _start(std::chrono::steady_clock::now()) {}
+
+  /// Seconds since construction
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+  }
+
+private:
+  const std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * Prints one result line
+ * @param qps number of qp updates timed
+ * @param iterations Newton iterations summed over all qp updates
+ * @param substeps substeps summed over all qp updates
+ */
+inline void
+report(const std::string & kernel,
+       History history,
+       unsigned long qps,
+       double seconds,
+       unsigned long iterations,
+       unsigned long substeps)
+{
+  std::cout << "[ BENCHMARK] " << std::left << std::setw(40) << kernel << std::setw(10)
+            << name(history) << std::right << std::fixed << std::setprecision(1) << std::setw(10)
+            << 1e9 * seconds / qps << " ns/qp" << std::setprecision(3) << std::setw(9)
+            << double(iterations) / qps << " its/qp" << std::setw(9) << double(substeps) / qps
+            << " substeps/qp" << std::endl;
+  std::cout.unsetf(std::ios::fixed);
+}
+}